@@ -1,7 +1,12 @@
 #ifndef CHAOS_CIPHER_ARC4_ARC4CRYPT_HPP
 #define CHAOS_CIPHER_ARC4_ARC4CRYPT_HPP
 
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
 #include "Arc4Gen.hpp"
+#include "Service/ByteIterator.hpp"
 #include "Service/SeArray.hpp"
 #include "Service/ChaosException.hpp"
 
@@ -21,6 +26,30 @@ public:
         RekeyImpl(keyBegin, keyEnd);
     }
 
+    Arc4Crypt(const Arc4Crypt & other) = default;
+
+    Arc4Crypt(Arc4Crypt && other) noexcept
+        : IsInitialized_(other.IsInitialized_),
+          Gen_(std::move(other.Gen_))
+    {
+        other.IsInitialized_ = false;
+    }
+
+    Arc4Crypt & operator=(const Arc4Crypt & other) = default;
+
+    Arc4Crypt & operator=(Arc4Crypt && other) noexcept
+    {
+        if (this != &other)
+        {
+            IsInitialized_ = other.IsInitialized_;
+            Gen_ = std::move(other.Gen_);
+
+            other.IsInitialized_ = false;
+        }
+
+        return *this;
+    }
+
     template<typename InputIt>
     void Rekey(InputIt keyBegin, InputIt keyEnd)
     {
@@ -63,19 +92,65 @@ private:
     template<typename OutputIt, typename InputIt>
     void EncryptDecryptImpl(OutputIt out, InputIt in, uint64_t count)
     {
-        Service::SeArray<uint8_t, 512> keyBuf;
+        if constexpr (Service::IsContiguousMutableByteIterator<OutputIt> &&
+                      Service::IsContiguousByteIterator<InputIt>)
+        {
+            if (count > 0)
+            {
+                EncryptDecryptContiguous(Service::ToBytePointer(out), Service::ToBytePointer(in), count);
+            }
+        }
+        else
+        {
+            Service::CacheAlignedSeArray<uint8_t, 512> keyBuf;
+
+            while (count > 0)
+            {
+                uint64_t keyMaterialBytes = std::min<uint64_t>(keyBuf.Size(), count);
+                Gen_.Generate(keyBuf.Begin(), keyMaterialBytes);
+
+                for (auto keyBufIt = keyBuf.Begin();
+                     keyMaterialBytes > 0 && count > 0;
+                     ++keyBufIt, --keyMaterialBytes, --count)
+                {
+                    *out++ = *in++ ^ *keyBufIt;
+                }
+            }
+        }
+    }
+
+    void EncryptDecryptContiguous(uint8_t * out, const uint8_t * in, uint64_t count)
+    {
+        Service::CacheAlignedSeArray<uint8_t, 512> keyBuf;
 
         while (count > 0)
         {
-            uint64_t keyMaterialBytes = std::min<uint64_t>(keyBuf.Size(), count);
+            const uint64_t keyMaterialBytes = std::min<uint64_t>(keyBuf.Size(), count);
             Gen_.Generate(keyBuf.Begin(), keyMaterialBytes);
 
-            for (auto keyBufIt = keyBuf.Begin();
-                 keyMaterialBytes > 0 && count > 0;
-                 ++keyBufIt, --keyMaterialBytes, --count)
+            const uint8_t * key = keyBuf.Begin();
+            uint64_t idx = 0;
+
+            for (; idx + sizeof(uint64_t) <= keyMaterialBytes; idx += sizeof(uint64_t))
+            {
+                uint64_t data;
+                uint64_t keyWord;
+
+                std::memcpy(&data, in + idx, sizeof(data));
+                std::memcpy(&keyWord, key + idx, sizeof(keyWord));
+
+                data ^= keyWord;
+                std::memcpy(out + idx, &data, sizeof(data));
+            }
+
+            for (; idx < keyMaterialBytes; ++idx)
             {
-                *out++ = *in++ ^ *keyBufIt;
+                out[idx] = in[idx] ^ key[idx];
             }
+
+            out += keyMaterialBytes;
+            in += keyMaterialBytes;
+            count -= keyMaterialBytes;
         }
     }
 };
@@ -1,11 +1,13 @@
 #ifndef CHAOS_CIPHER_ARC4_ARC4GEN_HPP
 #define CHAOS_CIPHER_ARC4_ARC4GEN_HPP
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
-#include <vector>
+#include <utility>
 
 #include "Service/ChaosException.hpp"
+#include "Service/SeArray.hpp"
 
 namespace Chaos::Cipher::Arc4
 {
@@ -23,6 +25,54 @@ public:
         RekeyImpl(keyBegin, keyEnd);
     }
 
+    // Copies duplicate the keystream state; Lookup_ is an SeArray, which
+    // deliberately has no copy operations, so it is copied element-wise.
+    Arc4Gen(const Arc4Gen & other)
+        : IsInitialized_(other.IsInitialized_),
+          I_(other.I_),
+          J_(other.J_)
+    {
+        std::copy(other.Lookup_.Begin(), other.Lookup_.End(), Lookup_.Begin());
+    }
+
+    Arc4Gen(Arc4Gen && other) noexcept
+        : IsInitialized_(other.IsInitialized_),
+          I_(other.I_),
+          J_(other.J_),
+          Lookup_(std::move(other.Lookup_))
+    {
+        other.ResetState();
+    }
+
+    Arc4Gen & operator=(const Arc4Gen & other)
+    {
+        if (this != &other)
+        {
+            IsInitialized_ = other.IsInitialized_;
+            I_ = other.I_;
+            J_ = other.J_;
+
+            std::copy(other.Lookup_.Begin(), other.Lookup_.End(), Lookup_.Begin());
+        }
+
+        return *this;
+    }
+
+    Arc4Gen & operator=(Arc4Gen && other) noexcept
+    {
+        if (this != &other)
+        {
+            IsInitialized_ = other.IsInitialized_;
+            I_ = other.I_;
+            J_ = other.J_;
+            Lookup_ = std::move(other.Lookup_);
+
+            other.ResetState();
+        }
+
+        return *this;
+    }
+
     template<typename InputIt>
     void Rekey(InputIt keyBegin, InputIt keyEnd)
     {
@@ -52,7 +102,7 @@ private:
 
     uint8_t I_;
     uint8_t J_;
-    std::array<uint8_t, 256> Lookup_;
+    Service::CacheAlignedSeArray<uint8_t, 256> Lookup_;
 
     void EnsureInitialized() const
     {
@@ -62,20 +112,33 @@ private:
         }
     }
 
+    void ResetState() noexcept
+    {
+        IsInitialized_ = false;
+        I_ = 0;
+        J_ = 0;
+    }
+
     template<typename InputIt>
     void RekeyImpl(InputIt keyBegin, InputIt keyEnd)
     {
         I_ = 0;
         J_ = 0;
 
-        for (uint64_t idx = 0; idx < Lookup_.size(); ++idx)
+        for (uint64_t idx = 0; idx < Lookup_.Size(); ++idx)
         {
             Lookup_[idx] = static_cast<uint8_t>(idx);
         }
 
-        std::vector<uint8_t> key(keyBegin, keyEnd);
+        Service::SeArray<uint8_t, 256> key;
+        uint64_t keySize = 0;
+
+        for (InputIt keyIt = keyBegin; keyIt != keyEnd && keySize < key.Size(); ++keyIt, ++keySize)
+        {
+            key[keySize] = static_cast<uint8_t>(*keyIt);
+        }
 
-        if (key.size() < 5)
+        if (keySize < 5)
         {
             throw Service::ChaosException("Arc4Gen: key is too small");
         }
@@ -83,10 +146,10 @@ private:
         uint8_t a = 0;
         uint8_t b = 0;
 
-        for (uint64_t idx = 0; idx < Lookup_.size(); ++idx)
+        for (uint64_t idx = 0; idx < Lookup_.Size(); ++idx)
         {
             a = static_cast<uint8_t>(idx);
-            b = b + Lookup_[a] + key[a % key.size()];
+            b = b + Lookup_[a] + key[a % keySize];
 
             std::swap(Lookup_[a], Lookup_[b]);
         }
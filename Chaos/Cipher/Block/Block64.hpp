@@ -0,0 +1,31 @@
+#ifndef CHAOS_CIPHER_BLOCK_BLOCK64_HPP
+#define CHAOS_CIPHER_BLOCK_BLOCK64_HPP
+
+#include <cstdint>
+
+namespace Chaos::Cipher::Block::Inner_
+{
+
+inline uint64_t LoadBlock64(const uint8_t * bytes)
+{
+    uint64_t result = 0;
+
+    for (int_fast8_t i = 0; i < 8; ++i)
+    {
+        result = (result << 8) | bytes[i];
+    }
+
+    return result;
+}
+
+inline void StoreBlock64(uint8_t * bytes, uint64_t block)
+{
+    for (int_fast8_t i = 0; i < 8; ++i)
+    {
+        bytes[i] = static_cast<uint8_t>(block >> (56 - (i * 8)));
+    }
+}
+
+} // namespace Chaos::Cipher::Block::Inner_
+
+#endif // CHAOS_CIPHER_BLOCK_BLOCK64_HPP
@@ -0,0 +1,202 @@
+#ifndef CHAOS_CIPHER_BLOCK_CBCHMAC_HPP
+#define CHAOS_CIPHER_BLOCK_CBCHMAC_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Cipher/Block/Block64.hpp"
+#include "Cipher/Block/Encryptor.hpp"
+#include "Cipher/Block/Decryptor.hpp"
+#include "Mac/Hmac.hpp"
+#include "Service/ChaosException.hpp"
+#include "Service/ConstantTime.hpp"
+#include "Service/SecureErase.hpp"
+
+namespace Chaos::Cipher::Block::Inner_
+{
+
+template<typename HasherImpl>
+using TagType = decltype(std::declval<HasherImpl &>().Finish().GetRawDigest());
+
+// Truncated tags shorter than this are refused (RFC 2104 section 5).
+template<typename HasherImpl>
+inline constexpr size_t MIN_TAG_SIZE = std::max<size_t>(10, std::tuple_size_v<TagType<HasherImpl>> / 2);
+
+template<typename HasherImpl>
+void UpdateBlock64(Mac::Hmac::Hmac<HasherImpl> & mac, uint64_t value)
+{
+    uint8_t bytes[sizeof(uint64_t)];
+    StoreBlock64(bytes, value);
+
+    mac.Update(bytes, bytes + sizeof(bytes));
+}
+
+} // namespace Chaos::Cipher::Block::Inner_
+
+namespace Chaos::Cipher::Block
+{
+
+// CBC encryption with an HMAC tag over AD || IV || C || AL, where AL is
+// the bit length of the associated data as a 64-bit big-endian integer
+// (RFC 7518 section 5.2.2).
+template<typename EncryptorImpl, typename HasherImpl,
+         typename = std::enable_if_t<std::is_base_of_v<Encryptor<EncryptorImpl>, EncryptorImpl>>>
+class CbcHmacEncryptor
+{
+public:
+    using Key = typename EncryptorImpl::Key;
+    using TagType = Inner_::TagType<HasherImpl>;
+
+    static constexpr size_t BlockSize = EncryptorImpl::BlockSize;
+    static constexpr size_t ChunkSize = HasherImpl::BLOCK_SIZE_BYTES;
+
+    static_assert(BlockSize == sizeof(uint64_t));
+    static_assert(ChunkSize % BlockSize == 0);
+
+    template<typename InputIt>
+    CbcHmacEncryptor(const Key & key, InputIt macKeyBegin, InputIt macKeyEnd)
+        : Encryptor_(key),
+          MacPrototype_(macKeyBegin, macKeyEnd),
+          Mac_(MacPrototype_)
+    { }
+
+    // Associated data; may be given in several pieces before the next
+    // Encrypt or Decrypt call.
+    template<typename InputIt>
+    void Authenticate(InputIt begin, InputIt end)
+    {
+        AdSizeBytes_ += static_cast<uint64_t>(std::distance(begin, end));
+        Mac_.Update(begin, end);
+    }
+
+    TagType Encrypt(uint8_t * out, const uint8_t * in, size_t size, uint64_t iv)
+    {
+        if (size % BlockSize != 0)
+        {
+            throw Service::ChaosException("CbcHmacEncryptor: input size is not a multiple of the block size");
+        }
+
+        Inner_::UpdateBlock64(Mac_, iv);
+
+        uint64_t chain = iv;
+
+        for (size_t offset = 0; offset < size; offset += ChunkSize)
+        {
+            const size_t chunkSize = std::min(ChunkSize, size - offset);
+
+            for (size_t i = offset; i < offset + chunkSize; i += BlockSize)
+            {
+                chain = Encryptor_.EncryptBlock(Inner_::LoadBlock64(in + i) ^ chain);
+                Inner_::StoreBlock64(out + i, chain);
+            }
+
+            Mac_.Update(out + offset, out + offset + chunkSize);
+        }
+
+        Inner_::UpdateBlock64(Mac_, AdSizeBytes_ * 8);
+
+        TagType tag = Mac_.Finish().GetRawDigest();
+        Mac_ = MacPrototype_;
+        AdSizeBytes_ = 0;
+
+        return tag;
+    }
+
+private:
+    EncryptorImpl Encryptor_;
+    Mac::Hmac::Hmac<HasherImpl> MacPrototype_;
+    Mac::Hmac::Hmac<HasherImpl> Mac_;
+    uint64_t AdSizeBytes_ = 0;
+};
+
+template<typename DecryptorImpl, typename HasherImpl,
+         typename = std::enable_if_t<std::is_base_of_v<Decryptor<DecryptorImpl>, DecryptorImpl>>>
+class CbcHmacDecryptor
+{
+public:
+    using Key = typename DecryptorImpl::Key;
+    using TagType = Inner_::TagType<HasherImpl>;
+
+    static constexpr size_t BlockSize = DecryptorImpl::BlockSize;
+    static constexpr size_t ChunkSize = HasherImpl::BLOCK_SIZE_BYTES;
+
+    static_assert(BlockSize == sizeof(uint64_t));
+    static_assert(ChunkSize % BlockSize == 0);
+
+    template<typename InputIt>
+    CbcHmacDecryptor(const Key & key, InputIt macKeyBegin, InputIt macKeyEnd)
+        : Decryptor_(key),
+          MacPrototype_(macKeyBegin, macKeyEnd),
+          Mac_(MacPrototype_)
+    { }
+
+    // Associated data; may be given in several pieces before the next
+    // Encrypt or Decrypt call.
+    template<typename InputIt>
+    void Authenticate(InputIt begin, InputIt end)
+    {
+        AdSizeBytes_ += static_cast<uint64_t>(std::distance(begin, end));
+        Mac_.Update(begin, end);
+    }
+
+    bool Decrypt(uint8_t * out, const uint8_t * in, size_t size, uint64_t iv,
+                 const uint8_t * tag, size_t tagSize)
+    {
+        if (size % BlockSize != 0)
+        {
+            throw Service::ChaosException("CbcHmacDecryptor: input size is not a multiple of the block size");
+        }
+
+        if (tagSize < Inner_::MIN_TAG_SIZE<HasherImpl> || tagSize > std::tuple_size_v<TagType>)
+        {
+            throw Service::ChaosException("CbcHmacDecryptor: invalid tag size");
+        }
+
+        Inner_::UpdateBlock64(Mac_, iv);
+
+        uint64_t chain = iv;
+
+        for (size_t offset = 0; offset < size; offset += ChunkSize)
+        {
+            const size_t chunkSize = std::min(ChunkSize, size - offset);
+
+            Mac_.Update(in + offset, in + offset + chunkSize);
+
+            for (size_t i = offset; i < offset + chunkSize; i += BlockSize)
+            {
+                const uint64_t block = Inner_::LoadBlock64(in + i);
+                Inner_::StoreBlock64(out + i, Decryptor_.DecryptBlock(block) ^ chain);
+                chain = block;
+            }
+        }
+
+        Inner_::UpdateBlock64(Mac_, AdSizeBytes_ * 8);
+
+        const TagType expected = Mac_.Finish().GetRawDigest();
+        Mac_ = MacPrototype_;
+        AdSizeBytes_ = 0;
+
+        if (!Service::ConstantTimeEqual(expected.data(), tag, tagSize))
+        {
+            Service::SecureErase(out, size);
+            return false;
+        }
+
+        return true;
+    }
+
+private:
+    DecryptorImpl Decryptor_;
+    Mac::Hmac::Hmac<HasherImpl> MacPrototype_;
+    Mac::Hmac::Hmac<HasherImpl> Mac_;
+    uint64_t AdSizeBytes_ = 0;
+};
+
+} // namespace Chaos::Cipher::Block
+
+#endif // CHAOS_CIPHER_BLOCK_CBCHMAC_HPP
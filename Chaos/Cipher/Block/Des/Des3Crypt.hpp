@@ -0,0 +1,152 @@
+#ifndef CHAOS_CIPHER_BLOCK_DES_DES3CRYPT_HPP
+#define CHAOS_CIPHER_BLOCK_DES_DES3CRYPT_HPP
+
+#include <cstdint>
+
+#include "DesCrypt.hpp"
+
+namespace Chaos::Cipher::Block::Des
+{
+
+class Des3Crypt
+{
+public:
+    using Block = DesCrypt::Block;
+    static constexpr size_t BlockSize = DesCrypt::BlockSize;
+    static constexpr size_t KeySize = 3 * DesCrypt::KeySize;
+
+    Des3Crypt() = delete;
+
+    class Key
+    {
+        friend class Des3Crypt;
+    public:
+        template<typename InputIt>
+        Key(InputIt keyBegin, InputIt keyEnd)
+        {
+            int_fast8_t i = 0;
+            InputIt keyIt = keyBegin;
+            for (; i < static_cast<int_fast8_t>(KeySize) && keyIt != keyEnd; ++i, ++keyIt)
+            {
+                Keys_[i / 8][i % 8] = *keyIt;
+            }
+
+            if (i == 2 * DesCrypt::KeySize && keyIt == keyEnd)
+            {
+                Keys_[2] = CopyKey(Keys_[0]);
+            }
+            else if (i != KeySize || keyIt != keyEnd)
+            {
+                throw Service::ChaosException("Des3Crypt::Key: invalid key length "
+                                              "(16 or 24 bytes required)");
+            }
+        }
+
+    private:
+        Inner_::RawKey Keys_[3];
+
+        static Inner_::RawKey CopyKey(const Inner_::RawKey & key)
+        {
+            Inner_::RawKey result;
+            std::copy(key.Begin(), key.End(), result.Begin());
+
+            return result;
+        }
+    };
+
+    class Des3Encryptor : public Encryptor<Des3Encryptor>
+    {
+    public:
+        using Key = Des3Crypt::Key;
+        static constexpr size_t BlockSize = Des3Crypt::BlockSize;
+        static constexpr size_t KeySize = Des3Crypt::KeySize;
+
+        Des3Encryptor(const Key & key)
+            : Schedule1_(Inner_::KeySchedule::Direction::Encrypt, key.Keys_[0]),
+              Schedule2_(Inner_::KeySchedule::Direction::Decrypt, key.Keys_[1]),
+              Schedule3_(Inner_::KeySchedule::Direction::Encrypt, key.Keys_[2])
+        { }
+
+        template<typename OutputIt, typename InputIt>
+        void EncryptBlock(OutputIt outBegin, OutputIt outEnd,
+                          InputIt inBegin, InputIt inEnd) const
+        {
+            Inner_::Bitwise::CrunchUInt64(outBegin, outEnd,
+                                          EncryptBlock(DesCrypt::LoadBlock(inBegin, inEnd)));
+        }
+
+        Block EncryptBlock(Block block) const
+        {
+            return Des3Crypt::ProcessBlock(block, Schedule1_, Schedule2_, Schedule3_);
+        }
+
+        constexpr size_t GetBlockSize() const
+        {
+            return BlockSize;
+        }
+
+    private:
+        Inner_::KeySchedule Schedule1_;
+        Inner_::KeySchedule Schedule2_;
+        Inner_::KeySchedule Schedule3_;
+    };
+
+    class Des3Decryptor : public Decryptor<Des3Decryptor>
+    {
+    public:
+        using Key = Des3Crypt::Key;
+        static constexpr size_t BlockSize = Des3Crypt::BlockSize;
+        static constexpr size_t KeySize = Des3Crypt::KeySize;
+
+        Des3Decryptor(const Key & key)
+            : Schedule1_(Inner_::KeySchedule::Direction::Decrypt, key.Keys_[2]),
+              Schedule2_(Inner_::KeySchedule::Direction::Encrypt, key.Keys_[1]),
+              Schedule3_(Inner_::KeySchedule::Direction::Decrypt, key.Keys_[0])
+        { }
+
+        template<typename OutputIt, typename InputIt>
+        void DecryptBlock(OutputIt outBegin, OutputIt outEnd,
+                          InputIt inBegin, InputIt inEnd) const
+        {
+            Inner_::Bitwise::CrunchUInt64(outBegin, outEnd,
+                                          DecryptBlock(DesCrypt::LoadBlock(inBegin, inEnd)));
+        }
+
+        Block DecryptBlock(Block block) const
+        {
+            return Des3Crypt::ProcessBlock(block, Schedule1_, Schedule2_, Schedule3_);
+        }
+
+        constexpr size_t GetBlockSize() const
+        {
+            return BlockSize;
+        }
+
+    private:
+        Inner_::KeySchedule Schedule1_;
+        Inner_::KeySchedule Schedule2_;
+        Inner_::KeySchedule Schedule3_;
+    };
+
+private:
+    static Block ProcessBlock(Block block,
+                              const Inner_::KeySchedule & schedule1,
+                              const Inner_::KeySchedule & schedule2,
+                              const Inner_::KeySchedule & schedule3)
+    {
+        DesCrypt::BlockHalf l = static_cast<DesCrypt::BlockHalf>(block >> 32);
+        DesCrypt::BlockHalf r = static_cast<DesCrypt::BlockHalf>(block);
+
+        DesCrypt::Ip(l, r);
+        DesCrypt::Rounds(l, r, schedule1);
+        DesCrypt::Rounds(l, r, schedule2);
+        DesCrypt::Rounds(l, r, schedule3);
+        DesCrypt::Fp(l, r);
+
+        return Inner_::Bitwise::Merge<32>(l, r);
+    }
+};
+
+} // namespace Chaos::Cipher::Block::Des
+
+#endif // CHAOS_CIPHER_BLOCK_DES_DES3CRYPT_HPP
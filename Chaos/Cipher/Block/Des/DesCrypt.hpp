@@ -2,6 +2,7 @@
 #define CHAOS_CIPHER_BLOCK_DES_DESCRYPT_HPP
 
 #include <algorithm>
+#include <cstdint>
 #include <utility>
 
 #include "Service/ChaosException.hpp"
@@ -15,35 +16,6 @@ namespace Chaos::Cipher::Block::Des::Inner_
 
 struct Bitwise
 {
-    template<uint8_t BitsUsed>
-    static uint8_t GetBit(uint64_t value, int_fast8_t bitNumber)
-    {
-        return (value >> (BitsUsed - bitNumber)) & 0b1;
-    }
-
-    template<uint8_t BitsUsed>
-    static void SetBit(uint64_t & value, int_fast8_t bitNumber)
-    {
-        value |= (static_cast<uint64_t>(0b1) << (BitsUsed - bitNumber));
-    }
-
-    template<uint8_t BitsUsedIn, uint8_t BitsUsedOut, typename InputIt>
-    static uint64_t TableChoice(uint64_t value, InputIt tableBegin, InputIt tableEnd)
-    {
-        uint64_t result = 0;
-
-        int_fast8_t i = 1;
-        for (InputIt it = tableBegin; it != tableEnd; ++it, ++i)
-        {
-            if (GetBit<BitsUsedIn>(value, *it))
-            {
-                SetBit<BitsUsedOut>(result, i);
-            }
-        }
-
-        return result;
-    }
-
     template<uint8_t Bits>
     static constexpr uint64_t Mask()
     {
@@ -95,6 +67,184 @@ struct Bitwise
 
 using RawKey = Service::SeArray<uint8_t, 8>;
 
+inline constexpr uint8_t SBOX_TABLES[8][64] =
+{
+    {
+        14,  0,  4, 15, 13,  7,  1,  4,  2, 14, 15,  2, 11, 13,  8,  1,
+         3, 10, 10,  6,  6, 12, 12, 11,  5,  9,  9,  5,  0,  3,  7,  8,
+         4, 15,  1, 12, 14,  8,  8,  2, 13,  4,  6,  9,  2,  1, 11,  7,
+        15,  5, 12, 11,  9,  3,  7, 14,  3, 10, 10,  0,  5,  6,  0, 13
+    },
+    {
+        15,  3,  1, 13,  8,  4, 14,  7,  6, 15, 11,  2,  3,  8,  4, 14,
+         9, 12,  7,  0,  2,  1, 13, 10, 12,  6,  0,  9,  5, 11, 10,  5,
+         0, 13, 14,  8,  7, 10, 11,  1, 10,  3,  4, 15, 13,  4,  1,  2,
+         5, 11,  8,  6, 12,  7,  6, 12,  9,  0,  3,  5,  2, 14, 15,  9
+    },
+    {
+        10, 13,  0,  7,  9,  0, 14,  9,  6,  3,  3,  4, 15,  6,  5, 10,
+         1,  2, 13,  8, 12,  5,  7, 14, 11, 12,  4, 11,  2, 15,  8,  1,
+        13,  1,  6, 10,  4, 13,  9,  0,  8,  6, 15,  9,  3,  8,  0,  7,
+        11,  4,  1, 15,  2, 14, 12,  3,  5, 11, 10,  5, 14,  2,  7, 12
+    },
+    {
+         7, 13, 13,  8, 14, 11,  3,  5,  0,  6,  6, 15,  9,  0, 10,  3,
+         1,  4,  2,  7,  8,  2,  5, 12, 11,  1, 12, 10,  4, 14, 15,  9,
+        10,  3,  6, 15,  9,  0,  0,  6, 12, 10, 11,  1,  7, 13, 13,  8,
+        15,  9,  1,  4,  3,  5, 14, 11,  5, 12,  2,  7,  8,  2,  4, 14
+    },
+    {
+         2, 14, 12, 11,  4,  2,  1, 12,  7,  4, 10,  7, 11, 13,  6,  1,
+         8,  5,  5,  0,  3, 15, 15, 10, 13,  3,  0,  9, 14,  8,  9,  6,
+         4, 11,  2,  8,  1, 12, 11,  7, 10,  1, 13, 14,  7,  2,  8, 13,
+        15,  6,  9, 15, 12,  0,  5,  9,  6, 10,  3,  4,  0,  5, 14,  3
+    },
+    {
+        12, 10,  1, 15, 10,  4, 15,  2,  9,  7,  2, 12,  6,  9,  8,  5,
+         0,  6, 13,  1,  3, 13,  4, 14, 14,  0,  7, 11,  5,  3, 11,  8,
+         9,  4, 14,  3, 15,  2,  5, 12,  2,  9,  8,  5, 12, 15,  3, 10,
+         7, 11,  0, 14,  4,  1, 10,  7,  1,  6, 13,  0, 11,  8,  6, 13
+    },
+    {
+         4, 13, 11,  0,  2, 11, 14,  7, 15,  4,  0,  9,  8,  1, 13, 10,
+         3, 14, 12,  3,  9,  5,  7, 12,  5,  2, 10, 15,  6,  8,  1,  6,
+         1,  6,  4, 11, 11, 13, 13,  8, 12,  1,  3,  4,  7, 10, 14,  7,
+        10,  9, 15,  5,  6,  0,  8, 15,  0, 14,  5,  2,  9,  3,  2, 12
+    },
+    {
+        13,  1,  2, 15,  8, 13,  4,  8,  6, 10, 15,  3, 11,  7,  1,  4,
+        10, 12,  9,  5,  3,  6, 14, 11,  5,  0,  0, 14, 12,  9,  7,  2,
+         7,  2, 11,  1,  4, 14,  1,  7,  9,  4, 12, 10, 14,  8,  2, 13,
+         0, 15,  6, 12, 10,  9, 13,  0, 15,  3,  3,  5,  5,  6,  8, 11
+    }
+};
+
+static_assert(std::size(SBOX_TABLES) == 8);
+
+inline constexpr int_fast8_t P_TABLE[32] =
+{
+    16,  7, 20, 21,
+    29, 12, 28, 17,
+     1, 15, 23, 26,
+     5, 18, 31, 10,
+     2,  8, 24, 14,
+    32, 27,  3,  9,
+    19, 13, 30,  6,
+    22, 11,  4, 25
+};
+
+static_assert(std::size(P_TABLE) == 32);
+
+struct SpTables
+{
+    uint32_t Table_[8][64];
+};
+
+constexpr SpTables MakeSpTables()
+{
+    SpTables result = {};
+
+    for (int_fast8_t box = 0; box < 8; ++box)
+    {
+        for (int_fast8_t input = 0; input < 64; ++input)
+        {
+            const uint32_t substituted = static_cast<uint32_t>(SBOX_TABLES[box][input]) << (28 - (box * 4));
+
+            uint32_t permuted = 0;
+
+            for (int_fast8_t bit = 0; bit < 32; ++bit)
+            {
+                if ((substituted >> (32 - P_TABLE[bit])) & 0b1)
+                {
+                    permuted |= static_cast<uint32_t>(0b1) << (31 - bit);
+                }
+            }
+
+            result.Table_[box][input] = permuted;
+        }
+    }
+
+    return result;
+}
+
+inline constexpr SpTables SP_TABLES = MakeSpTables();
+
+inline constexpr int_fast8_t PC1_TABLE[56] =
+{
+    57, 49, 41, 33, 25, 17,  9,
+     1, 58, 50, 42, 34, 26, 18,
+    10,  2, 59, 51, 43, 35, 27,
+    19, 11,  3, 60, 52, 44, 36,
+    63, 55, 47, 39, 31, 23, 15,
+     7, 62, 54, 46, 38, 30, 22,
+    14,  6, 61, 53, 45, 37, 29,
+    21, 13,  5, 28, 20, 12,  4
+};
+
+inline constexpr int_fast8_t PC2_TABLE[48] =
+{
+    14, 17, 11, 24,  1,  5,
+     3, 28, 15,  6, 21, 10,
+    23, 19, 12,  4, 26,  8,
+    16,  7, 27, 20, 13,  2,
+    41, 52, 31, 37, 47, 55,
+    30, 40, 51, 45, 33, 48,
+    44, 49, 39, 56, 34, 53,
+    46, 42, 50, 36, 29, 32
+};
+
+// A bit permutation split per input byte: entry [i][v] holds the output
+// bits contributed by input byte i having value v, so a permutation costs
+// one lookup per input byte instead of one test per output bit.
+template<uint8_t BitsUsedIn>
+struct ChoiceTables
+{
+    static constexpr int_fast8_t BYTE_COUNT = BitsUsedIn / 8;
+
+    uint64_t Table_[BYTE_COUNT][256];
+
+    uint64_t operator()(uint64_t value) const
+    {
+        uint64_t result = 0;
+
+        for (int_fast8_t i = 0; i < BYTE_COUNT; ++i)
+        {
+            result |= Table_[i][(value >> (BitsUsedIn - 8 - (i * 8))) & 0xff];
+        }
+
+        return result;
+    }
+};
+
+template<uint8_t BitsUsedIn, uint8_t BitsUsedOut, size_t TableSize>
+constexpr ChoiceTables<BitsUsedIn> MakeChoiceTables(const int_fast8_t (&table)[TableSize])
+{
+    static_assert(BitsUsedIn % 8 == 0 && TableSize == BitsUsedOut);
+
+    ChoiceTables<BitsUsedIn> result = {};
+
+    for (int_fast8_t out = 0; out < BitsUsedOut; ++out)
+    {
+        const int_fast8_t in = table[out] - 1;
+        const int_fast8_t byte = in / 8;
+        const int_fast8_t shift = 7 - (in % 8);
+
+        for (int_fast16_t value = 0; value < 256; ++value)
+        {
+            if ((value >> shift) & 0b1)
+            {
+                result.Table_[byte][value] |= static_cast<uint64_t>(0b1) << (BitsUsedOut - 1 - out);
+            }
+        }
+    }
+
+    return result;
+}
+
+inline constexpr ChoiceTables<64> PC1_TABLES = MakeChoiceTables<64, 56>(PC1_TABLE);
+inline constexpr ChoiceTables<56> PC2_TABLES = MakeChoiceTables<56, 48>(PC2_TABLE);
+
+
 class KeySchedule
 {
 public:
@@ -143,48 +293,16 @@ public:
     }
 
 private:
-    Service::SeArray<RoundKey48, 16> Schedule_;
+    Service::CacheAlignedSeArray<RoundKey48, 16> Schedule_;
 
     static Key56 Pc1(Key64 key)
     {
-        constexpr int_fast8_t PC1_TABLE[] =
-        {
-            57, 49, 41, 33, 25, 17,  9,
-             1, 58, 50, 42, 34, 26, 18,
-            10,  2, 59, 51, 43, 35, 27,
-            19, 11,  3, 60, 52, 44, 36,
-            63, 55, 47, 39, 31, 23, 15,
-             7, 62, 54, 46, 38, 30, 22,
-            14,  6, 61, 53, 45, 37, 29,
-            21, 13,  5, 28, 20, 12,  4
-        };
-
-        static_assert(std::size(PC1_TABLE) == 56);
-
-        return Bitwise::TableChoice<64, 56>(key,
-                                            PC1_TABLE,
-                                            PC1_TABLE + std::size(PC1_TABLE));
+        return PC1_TABLES(key);
     }
 
     static RoundKey48 Pc2(Key56 key)
     {
-        constexpr int_fast8_t PC2_TABLE[] =
-        {
-            14, 17, 11, 24,  1,  5,
-             3, 28, 15,  6, 21, 10,
-            23, 19, 12,  4, 26,  8,
-            16,  7, 27, 20, 13,  2,
-            41, 52, 31, 37, 47, 55,
-            30, 40, 51, 45, 33, 48,
-            44, 49, 39, 56, 34, 53,
-            46, 42, 50, 36, 29, 32
-        };
-
-        static_assert(std::size(PC2_TABLE) == 48);
-
-        return Bitwise::TableChoice<56, 48>(key,
-                                            PC2_TABLE,
-                                            PC2_TABLE + std::size(PC2_TABLE));
+        return PC2_TABLES(key);
     }
 };
 
@@ -195,6 +313,8 @@ namespace Chaos::Cipher::Block::Des
 
 class DesCrypt
 {
+    friend class Des3Crypt;
+
 public:
     using Block = uint64_t;
     static constexpr size_t BlockSize = 8;
@@ -245,18 +365,7 @@ public:
         void EncryptBlock(OutputIt outBegin, OutputIt outEnd,
                           InputIt inBegin, InputIt inEnd) const
         {
-            RawBlockArray block;
-
-            int_fast8_t i = 0;
-            for (InputIt in = inBegin; i < block.Size() && in != inEnd; ++i, ++in)
-            {
-                block[i] = *in;
-            }
-
-            Block encrypted
-                = DesCrypt::ProcessBlock(Inner_::Bitwise::PackUInt64(block.Begin(),
-                                                                     block.End()),
-                                         Schedule_);
+            Block encrypted = DesCrypt::ProcessBlock(DesCrypt::LoadBlock(inBegin, inEnd), Schedule_);
 
             Inner_::Bitwise::CrunchUInt64(outBegin, outEnd, encrypted);
         }
@@ -290,18 +399,7 @@ public:
         void DecryptBlock(OutputIt outBegin, OutputIt outEnd,
                           InputIt inBegin, InputIt inEnd) const
         {
-            RawBlockArray block;
-
-            int_fast8_t i = 0;
-            for (InputIt in = inBegin; i < block.Size() && in != inEnd; ++i, ++in)
-            {
-                block[i] = *in;
-            }
-
-            Block decrypted
-                = DesCrypt::ProcessBlock(Inner_::Bitwise::PackUInt64(block.Begin(),
-                                                                     block.End()),
-                                         Schedule_);
+            Block decrypted = DesCrypt::ProcessBlock(DesCrypt::LoadBlock(inBegin, inEnd), Schedule_);
 
             Inner_::Bitwise::CrunchUInt64(outBegin, outEnd, decrypted);
         }
@@ -323,192 +421,87 @@ public:
 private:
     using BlockHalf = uint32_t;
     using RawBlockArray = Service::SeArray<uint8_t, 8>;
-    using Data48 = uint64_t;
-    using Data32 = uint32_t;
-    using Data6 = uint8_t;
-    using Data4 = uint8_t;
 
-    static Data48 E(Data32 value)
-    {
-        constexpr int_fast8_t E_TABLE[] =
-        {
-            32,  1,  2,  3,  4,  5,
-             4,  5,  6,  7,  8,  9,
-             8,  9, 10, 11, 12, 13,
-            12, 13, 14, 15, 16, 17,
-            16, 17, 18, 19, 20, 21,
-            20, 21, 22, 23, 24, 25,
-            24, 25, 26, 27, 28, 29,
-            28, 29, 30, 31, 32,  1
-        };
-
-        static_assert(std::size(E_TABLE) == 48);
-
-        return Inner_::Bitwise::TableChoice<32, 48>(value,
-                                                    E_TABLE,
-                                                    E_TABLE + std::size(E_TABLE));
-    }
-
-    static Data32 SBlock(Data48 value)
+    template<typename InputIt>
+    static Block LoadBlock(InputIt inBegin, InputIt inEnd)
     {
-        constexpr Data4 SBOX_TABLES[][64] =
-        {
-            {
-                14,  0,  4, 15, 13,  7,  1,  4,  2, 14, 15,  2, 11, 13,  8,  1,
-                 3, 10, 10,  6,  6, 12, 12, 11,  5,  9,  9,  5,  0,  3,  7,  8,
-                 4, 15,  1, 12, 14,  8,  8,  2, 13,  4,  6,  9,  2,  1, 11,  7,
-                15,  5, 12, 11,  9,  3,  7, 14,  3, 10, 10,  0,  5,  6,  0, 13
-            },
-            {
-                15,  3,  1, 13,  8,  4, 14,  7,  6, 15, 11,  2,  3,  8,  4, 14,
-                 9, 12,  7,  0,  2,  1, 13, 10, 12,  6,  0,  9,  5, 11, 10,  5,
-                 0, 13, 14,  8,  7, 10, 11,  1, 10,  3,  4, 15, 13,  4,  1,  2,
-                 5, 11,  8,  6, 12,  7,  6, 12,  9,  0,  3,  5,  2, 14, 15,  9
-            },
-            {
-                10, 13,  0,  7,  9,  0, 14,  9,  6,  3,  3,  4, 15,  6,  5, 10,
-                 1,  2, 13,  8, 12,  5,  7, 14, 11, 12,  4, 11,  2, 15,  8,  1,
-                13,  1,  6, 10,  4, 13,  9,  0,  8,  6, 15,  9,  3,  8,  0,  7,
-                11,  4,  1, 15,  2, 14, 12,  3,  5, 11, 10,  5, 14,  2,  7, 12
-            },
-            {
-                 7, 13, 13,  8, 14, 11,  3,  5,  0,  6,  6, 15,  9,  0, 10,  3,
-                 1,  4,  2,  7,  8,  2,  5, 12, 11,  1, 12, 10,  4, 14, 15,  9,
-                10,  3,  6, 15,  9,  0,  0,  6, 12, 10, 11,  1,  7, 13, 13,  8,
-                15,  9,  1,  4,  3,  5, 14, 11,  5, 12,  2,  7,  8,  2,  4, 14
-            },
-            {
-                 2, 14, 12, 11,  4,  2,  1, 12,  7,  4, 10,  7, 11, 13,  6,  1,
-                 8,  5,  5,  0,  3, 15, 15, 10, 13,  3,  0,  9, 14,  8,  9,  6,
-                 4, 11,  2,  8,  1, 12, 11,  7, 10,  1, 13, 14,  7,  2,  8, 13,
-                15,  6,  9, 15, 12,  0,  5,  9,  6, 10,  3,  4,  0,  5, 14,  3
-            },
-            {
-                12, 10,  1, 15, 10,  4, 15,  2,  9,  7,  2, 12,  6,  9,  8,  5,
-                 0,  6, 13,  1,  3, 13,  4, 14, 14,  0,  7, 11,  5,  3, 11,  8,
-                 9,  4, 14,  3, 15,  2,  5, 12,  2,  9,  8,  5, 12, 15,  3, 10,
-                 7, 11,  0, 14,  4,  1, 10,  7,  1,  6, 13,  0, 11,  8,  6, 13
-            },
-            {
-                 4, 13, 11,  0,  2, 11, 14,  7, 15,  4,  0,  9,  8,  1, 13, 10,
-                 3, 14, 12,  3,  9,  5,  7, 12,  5,  2, 10, 15,  6,  8,  1,  6,
-                 1,  6,  4, 11, 11, 13, 13,  8, 12,  1,  3,  4,  7, 10, 14,  7,
-                10,  9, 15,  5,  6,  0,  8, 15,  0, 14,  5,  2,  9,  3,  2, 12
-            },
-            {
-                13,  1,  2, 15,  8, 13,  4,  8,  6, 10, 15,  3, 11,  7,  1,  4,
-                10, 12,  9,  5,  3,  6, 14, 11,  5,  0,  0, 14, 12,  9,  7,  2,
-                 7,  2, 11,  1,  4, 14,  1,  7,  9,  4, 12, 10, 14,  8,  2, 13,
-                 0, 15,  6, 12, 10,  9, 13,  0, 15,  3,  3,  5,  5,  6,  8, 11
-            }
-        };
+        RawBlockArray block;
 
-        static_assert(std::size(SBOX_TABLES) == 8);
-
-        Data32 result = 0;
-
-        for (int_fast8_t i = 0; i < 8; ++i)
+        int_fast8_t i = 0;
+        for (InputIt in = inBegin; i < block.Size() && in != inEnd; ++i, ++in)
         {
-            Data6 input = (value >> (42 - (i * 6))) & Inner_::Bitwise::Mask<6>();
-            result |= static_cast<Data32>(SBOX_TABLES[i][input]) << (28 - (i * 4));
+            block[i] = *in;
         }
 
-        return result;
+        return Inner_::Bitwise::PackUInt64(block.Begin(), block.End());
     }
 
-    static Data32 P(Data32 value)
+    static BlockHalf F(BlockHalf value, Inner_::KeySchedule::RoundKey48 roundKey)
     {
-        constexpr int_fast8_t P_TABLE[] =
-        {
-            16,  7, 20, 21,
-            29, 12, 28, 17,
-             1, 15, 23, 26,
-             5, 18, 31, 10,
-             2,  8, 24, 14,
-            32, 27,  3,  9,
-            19, 13, 30,  6,
-            22, 11,  4, 25
-        };
-
-        static_assert(std::size(P_TABLE) == 32);
-
-        return Inner_::Bitwise::TableChoice<32, 32>(value,
-                                                    P_TABLE,
-                                                    P_TABLE + std::size(P_TABLE));
+        const auto & sp = Inner_::SP_TABLES.Table_;
+
+        return sp[0][(Rotl(value,  5) ^ (roundKey >> 42)) & 0x3f] ^
+               sp[1][(Rotl(value,  9) ^ (roundKey >> 36)) & 0x3f] ^
+               sp[2][(Rotl(value, 13) ^ (roundKey >> 30)) & 0x3f] ^
+               sp[3][(Rotl(value, 17) ^ (roundKey >> 24)) & 0x3f] ^
+               sp[4][(Rotl(value, 21) ^ (roundKey >> 18)) & 0x3f] ^
+               sp[5][(Rotl(value, 25) ^ (roundKey >> 12)) & 0x3f] ^
+               sp[6][(Rotl(value, 29) ^ (roundKey >>  6)) & 0x3f] ^
+               sp[7][(Rotl(value,  1) ^ (roundKey >>  0)) & 0x3f];
     }
 
-    static BlockHalf F(BlockHalf value, Inner_::KeySchedule::RoundKey48 roundKey)
+    static BlockHalf Rotl(BlockHalf value, int_fast8_t shift)
     {
-        Data48 expanded = E(value);
-        expanded = (expanded ^ roundKey) & Inner_::Bitwise::Mask<48>();
-
-        return P(SBlock(expanded));
+        return (value << shift) | (value >> (32 - shift));
     }
 
-    static Block Ip(Block block)
+    template<int_fast8_t Shift>
+    static void SwapMove(BlockHalf & a, BlockHalf & b, BlockHalf mask)
     {
-        constexpr int_fast8_t IP_TABLE[] =
-        {
-            58, 50, 42, 34, 26, 18, 10,  2,
-            60, 52, 44, 36, 28, 20, 12,  4,
-            62, 54, 46, 38, 30, 22, 14,  6,
-            64, 56, 48, 40, 32, 24, 16,  8,
-            57, 49, 41, 33, 25, 17,  9,  1,
-            59, 51, 43, 35, 27, 19, 11,  3,
-            61, 53, 45, 37, 29, 21, 13,  5,
-            63, 55, 47, 39, 31, 23, 15,  7
-        };
-
-        static_assert(std::size(IP_TABLE) == 64);
-
-        return Inner_::Bitwise::TableChoice<64, 64>(block,
-                                                    IP_TABLE,
-                                                    IP_TABLE + std::size(IP_TABLE));
+        BlockHalf t = ((a >> Shift) ^ b) & mask;
+        b ^= t;
+        a ^= t << Shift;
     }
 
-    static Block Fp(Block block)
+    static void Ip(BlockHalf & l, BlockHalf & r)
     {
-        constexpr int_fast8_t FP_TABLE[] =
-        {
-            40,  8, 48, 16, 56, 24, 64, 32,
-            39,  7, 47, 15, 55, 23, 63, 31,
-            38,  6, 46, 14, 54, 22, 62, 30,
-            37,  5, 45, 13, 53, 21, 61, 29,
-            36,  4, 44, 12, 52, 20, 60, 28,
-            35,  3, 43, 11, 51, 19, 59, 27,
-            34,  2, 42, 10, 50, 18, 58, 26,
-            33,  1, 41,  9, 49, 17, 57, 25
-        };
-
-        static_assert(std::size(FP_TABLE) == 64);
-
-        return Inner_::Bitwise::TableChoice<64, 64>(block,
-                                                    FP_TABLE,
-                                                    FP_TABLE + std::size(FP_TABLE));
+        SwapMove< 4>(l, r, 0x0f0f0f0f);
+        SwapMove<16>(l, r, 0x0000ffff);
+        SwapMove< 2>(r, l, 0x33333333);
+        SwapMove< 8>(r, l, 0x00ff00ff);
+        SwapMove< 1>(l, r, 0x55555555);
     }
 
-    static Block ProcessBlock(Block block, const Inner_::KeySchedule & schedule)
+    static void Fp(BlockHalf & l, BlockHalf & r)
     {
-        block = Ip(block);
-
-        uint32_t l32;
-        uint32_t r32;
+        SwapMove< 1>(l, r, 0x55555555);
+        SwapMove< 8>(r, l, 0x00ff00ff);
+        SwapMove< 2>(r, l, 0x33333333);
+        SwapMove<16>(l, r, 0x0000ffff);
+        SwapMove< 4>(l, r, 0x0f0f0f0f);
+    }
 
+    static void Rounds(BlockHalf & l, BlockHalf & r, const Inner_::KeySchedule & schedule)
+    {
+        for (int_fast8_t i = 0; i < 16; i += 2)
         {
-            auto [l, r] = Inner_::Bitwise::Split<32>(block);
-            l32 = static_cast<uint32_t>(l);
-            r32 = static_cast<uint32_t>(r);
+            l ^= F(r, schedule[i]);
+            r ^= F(l, schedule[i + 1]);
         }
 
-        for (int_fast8_t i = 0; i < 16; ++i)
-        {
-            uint32_t l32Old = l32;
+        std::swap(l, r);
+    }
 
-            l32 = r32;
-            r32 = l32Old ^ F(r32, schedule[i]);
-        }
+    static Block ProcessBlock(Block block, const Inner_::KeySchedule & schedule)
+    {
+        BlockHalf l = static_cast<BlockHalf>(block >> 32);
+        BlockHalf r = static_cast<BlockHalf>(block);
+
+        Ip(l, r);
+        Rounds(l, r, schedule);
+        Fp(l, r);
 
-        return Fp(Inner_::Bitwise::Merge<32>(r32, l32));
+        return Inner_::Bitwise::Merge<32>(l, r);
     }
 };
 
@@ -0,0 +1,103 @@
+#ifndef CHAOS_CPU_CPU_HPP
+#define CHAOS_CPU_CPU_HPP
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace Chaos::Cpu
+{
+
+struct Features
+{
+    bool Sse41 = false;
+    bool Avx2 = false;
+    bool Avx512F = false;
+    bool Avx512Bw = false;
+    bool Avx512Vl = false;
+    bool ShaNi = false;
+    bool Bmi2 = false;
+    bool Gfni = false;
+};
+
+} // namespace Chaos::Cpu
+
+namespace Chaos::Cpu::Inner_
+{
+
+#if defined(__x86_64__) || defined(__i386__)
+
+inline uint64_t ReadXcr0()
+{
+    uint32_t eax;
+    uint32_t edx;
+
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+}
+
+inline Features Detect()
+{
+    Features features;
+
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    {
+        return features;
+    }
+
+    const bool osxsave = (ecx >> 27) & 1;
+
+    features.Sse41 = (ecx >> 19) & 1;
+
+    uint64_t xcr0 = osxsave ? ReadXcr0() : 0;
+
+    const bool osAvx = (xcr0 & 0x06) == 0x06;
+    const bool osAvx512 = (xcr0 & 0xe6) == 0xe6;
+
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+    {
+        return features;
+    }
+
+    features.Avx2 = osAvx && ((ebx >> 5) & 1);
+    features.Bmi2 = (ebx >> 8) & 1;
+    features.Avx512F = osAvx512 && ((ebx >> 16) & 1);
+    features.ShaNi = (ebx >> 29) & 1;
+    features.Avx512Bw = osAvx512 && ((ebx >> 30) & 1);
+    features.Avx512Vl = osAvx512 && ((ebx >> 31) & 1);
+    features.Gfni = (ecx >> 8) & 1;
+
+    return features;
+}
+
+#else
+
+inline Features Detect()
+{
+    return Features();
+}
+
+#endif
+
+} // namespace Chaos::Cpu::Inner_
+
+namespace Chaos::Cpu
+{
+
+inline const Features & GetFeatures()
+{
+    static const Features features = Inner_::Detect();
+    return features;
+}
+
+} // namespace Chaos::Cpu
+
+#endif // CHAOS_CPU_CPU_HPP
@@ -0,0 +1,231 @@
+#ifndef CHAOS_CPU_DISPATCH_HPP
+#define CHAOS_CPU_DISPATCH_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Cpu/Cpu.hpp"
+#include "Service/ChaosException.hpp"
+
+namespace Chaos::Cpu
+{
+
+enum class Backend
+{
+    Portable,
+    Sse41,
+    Avx2,
+    Avx512,
+    ShaNi
+};
+
+inline const char * GetBackendName(Backend backend)
+{
+    switch (backend)
+    {
+    case Backend::Portable:
+        return "portable";
+    case Backend::Sse41:
+        return "sse41";
+    case Backend::Avx2:
+        return "avx2";
+    case Backend::Avx512:
+        return "avx512";
+    case Backend::ShaNi:
+        return "shani";
+    }
+
+    return "unknown";
+}
+
+inline std::optional<Backend> ParseBackend(std::string_view name)
+{
+    for (Backend backend : { Backend::Portable, Backend::Sse41, Backend::Avx2,
+                             Backend::Avx512, Backend::ShaNi })
+    {
+        if (name == GetBackendName(backend))
+        {
+            return backend;
+        }
+    }
+
+    return std::nullopt;
+}
+
+inline bool IsBackendSupported(Backend backend)
+{
+    const Features & features = GetFeatures();
+
+    switch (backend)
+    {
+    case Backend::Portable:
+        return true;
+    case Backend::Sse41:
+        return features.Sse41;
+    case Backend::Avx2:
+        return features.Avx2 && features.Bmi2;
+    case Backend::Avx512:
+        return features.Avx512F && features.Avx512Bw && features.Avx512Vl && features.Bmi2;
+    case Backend::ShaNi:
+        return features.ShaNi && features.Sse41;
+    }
+
+    return false;
+}
+
+} // namespace Chaos::Cpu
+
+namespace Chaos::Cpu::Inner_
+{
+
+inline constexpr int NO_FORCED_BACKEND = -1;
+
+struct OverrideState
+{
+    OverrideState()
+        : ForcedBackend_(NO_FORCED_BACKEND),
+          Generation_(1)
+    {
+        if (const char * name = std::getenv("CHAOS_BACKEND"))
+        {
+            std::optional<Backend> backend = ParseBackend(name);
+
+            if (backend && IsBackendSupported(*backend))
+            {
+                ForcedBackend_ = static_cast<int>(*backend);
+            }
+        }
+    }
+
+    std::atomic<int> ForcedBackend_;
+    std::atomic<uint64_t> Generation_;
+};
+
+inline OverrideState & GetOverrideState()
+{
+    static OverrideState state;
+    return state;
+}
+
+} // namespace Chaos::Cpu::Inner_
+
+namespace Chaos::Cpu
+{
+
+inline void ForceBackend(Backend backend)
+{
+    if (!IsBackendSupported(backend))
+    {
+        throw Service::ChaosException("Cpu: backend is not supported by this CPU");
+    }
+
+    Inner_::OverrideState & state = Inner_::GetOverrideState();
+
+    state.ForcedBackend_.store(static_cast<int>(backend));
+    state.Generation_.fetch_add(1);
+}
+
+inline void ResetForcedBackend()
+{
+    Inner_::OverrideState & state = Inner_::GetOverrideState();
+
+    state.ForcedBackend_.store(Inner_::NO_FORCED_BACKEND);
+    state.Generation_.fetch_add(1);
+}
+
+inline std::optional<Backend> GetForcedBackend()
+{
+    int forced = Inner_::GetOverrideState().ForcedBackend_.load();
+
+    if (forced == Inner_::NO_FORCED_BACKEND)
+    {
+        return std::nullopt;
+    }
+
+    return static_cast<Backend>(forced);
+}
+
+template<typename Fn>
+class Dispatcher
+{
+public:
+    Dispatcher(std::initializer_list<std::pair<Backend, Fn>> candidates)
+        : Candidates_(candidates),
+          Selected_(0),
+          Generation_(0)
+    {
+        if (Candidates_.empty() || Candidates_.back().first != Backend::Portable)
+        {
+            throw Service::ChaosException("Dispatcher: the last candidate must be the portable one");
+        }
+    }
+
+    Fn Get() const
+    {
+        return Candidates_[Resolve()].second;
+    }
+
+    Backend GetBackend() const
+    {
+        return Candidates_[Resolve()].first;
+    }
+
+private:
+    std::vector<std::pair<Backend, Fn>> Candidates_;
+
+    mutable std::atomic<size_t> Selected_;
+    mutable std::atomic<uint64_t> Generation_;
+
+    size_t Resolve() const
+    {
+        const uint64_t generation = Inner_::GetOverrideState().Generation_.load(std::memory_order_acquire);
+
+        if (generation == Generation_.load(std::memory_order_acquire))
+        {
+            return Selected_.load(std::memory_order_relaxed);
+        }
+
+        size_t selected = Select();
+
+        Selected_.store(selected, std::memory_order_relaxed);
+        Generation_.store(generation, std::memory_order_release);
+
+        return selected;
+    }
+
+    size_t Select() const
+    {
+        if (std::optional<Backend> forced = GetForcedBackend())
+        {
+            for (size_t idx = 0; idx < Candidates_.size(); ++idx)
+            {
+                if (Candidates_[idx].first == *forced)
+                {
+                    return idx;
+                }
+            }
+
+            return Candidates_.size() - 1;
+        }
+
+        for (size_t idx = 0; idx < Candidates_.size(); ++idx)
+        {
+            if (IsBackendSupported(Candidates_[idx].first))
+            {
+                return idx;
+            }
+        }
+
+        return Candidates_.size() - 1;
+    }
+};
+
+} // namespace Chaos::Cpu
+
+#endif // CHAOS_CPU_DISPATCH_HPP
@@ -1,6 +1,12 @@
 #ifndef CHAOS_HASH_HASHER_HPP
 #define CHAOS_HASH_HASHER_HPP
 
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+#include "Segment.hpp"
+
 namespace Chaos::Hash
 {
 
@@ -19,6 +25,28 @@ public:
         Impl().Update(begin, end);
     }
 
+    template<typename SegmentRange,
+             typename = std::enable_if_t<IsSegmentRange<SegmentRange>>>
+    void Update(const SegmentRange & segments)
+    {
+        for (const Segment & segment : segments)
+        {
+            const uint8_t * data = static_cast<const uint8_t *>(segment.Data);
+            Impl().Update(data, data + segment.Size);
+        }
+    }
+
+    void Update(std::initializer_list<Segment> segments)
+    {
+        Update<std::initializer_list<Segment>>(segments);
+    }
+
+    template<typename OutputIt, typename InputIt>
+    OutputIt CopyAndUpdate(OutputIt out, InputIt begin, InputIt end)
+    {
+        return Impl().CopyAndUpdate(out, begin, end);
+    }
+
     auto Finish()
     {
         return Impl().Finish();
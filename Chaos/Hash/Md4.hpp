@@ -7,6 +7,7 @@
 
 #include "Hash.hpp"
 #include "Hasher.hpp"
+#include "MerkleDamgard.hpp"
 
 namespace Chaos::Hash::Md4::Inner_
 {
@@ -129,6 +130,20 @@ private:
     }
 };
 
+struct Traits
+{
+    using Buffer = Inner_::Buffer;
+    using Block = Inner_::Block;
+
+    static constexpr ByteOrder WORD_ORDER = ByteOrder::LittleEndian;
+    static constexpr size_t LENGTH_SIZE_BYTES = 8;
+
+    static void Compress(Buffer & buffer, const Block & block)
+    {
+        Algorithm::UpdateBuffer(buffer, block);
+    }
+};
+
 } // namespace Chaos::Hash::Md4::Inner_
 
 namespace Chaos::Hash::Md4
@@ -163,142 +178,58 @@ class Md4Hasher : public Hasher<Md4Hasher>
 {
 public:
     using HashType = Md4Hash;
+    using Engine = MerkleDamgard<Inner_::Traits>;
 
-    static constexpr size_t BLOCK_SIZE_BYTES = 64;
+    static constexpr size_t BLOCK_SIZE_BYTES = MerkleDamgard<Inner_::Traits>::BLOCK_SIZE_BYTES;
 
-    Md4Hasher()
-    {
-        ResetImpl();
-    }
+    Md4Hasher() = default;
+
+    using Hasher<Md4Hasher>::Update;
 
     void Reset()
     {
-        ResetImpl();
+        Engine_.Reset();
     }
 
     template<typename InputIt>
     void Update(InputIt begin, InputIt end)
     {
-        MessageSizeBytes_ += UpdateImpl(begin, end);
+        Engine_.Update(begin, end);
     }
 
-    HashType Finish()
+    template<typename OutputIt, typename InputIt>
+    OutputIt CopyAndUpdate(OutputIt out, InputIt begin, InputIt end)
     {
-        uint64_t messageSizeBytesMod64 = MessageSizeBytes_ % 64;
-
-        int_fast8_t paddingNeededBytes;
-
-        if (messageSizeBytesMod64 < 56)
-        {
-            paddingNeededBytes = 56 - messageSizeBytesMod64;
-        }
-        else if (messageSizeBytesMod64 > 56)
-        {
-            paddingNeededBytes = 120 - messageSizeBytesMod64;
-        }
-        else
-        {
-            paddingNeededBytes = 64;
-        }
-
-        UpdateImpl(PAD_, PAD_ + paddingNeededBytes);
-
-        const uint64_t messageSizeBits = MessageSizeBytes_ * 8;
-
-        uint8_t encodedMessageSizeBits[] =
-        {
-            static_cast<uint8_t>((messageSizeBits >>  0) & 0xFF),
-            static_cast<uint8_t>((messageSizeBits >>  8) & 0xFF),
-            static_cast<uint8_t>((messageSizeBits >> 16) & 0xFF),
-            static_cast<uint8_t>((messageSizeBits >> 24) & 0xFF),
-            static_cast<uint8_t>((messageSizeBits >> 32) & 0xFF),
-            static_cast<uint8_t>((messageSizeBits >> 40) & 0xFF),
-            static_cast<uint8_t>((messageSizeBits >> 48) & 0xFF),
-            static_cast<uint8_t>((messageSizeBits >> 56) & 0xFF),
-        };
-
-        static_assert(std::size(encodedMessageSizeBits) == 8);
-
-        UpdateImpl(encodedMessageSizeBits,
-                   encodedMessageSizeBits + std::size(encodedMessageSizeBits));
+        return Engine_.CopyAndUpdate(out, begin, end);
+    }
 
+    HashType Finish()
+    {
         HashType result;
-
-        int_fast8_t i = 0;
-        for (int_fast8_t reg = 0; reg < 4; ++reg)
-        {
-            for (int_fast8_t shift = 0; shift < 32; shift += 8)
-            {
-                result.RawDigest_[i++] = (Buffer_.Regs_[reg] >> shift) & 0xFF;
-            }
-        }
+        Engine_.Finish(result.RawDigest_.data());
 
         return result;
     }
 
-private:
-    static constexpr uint8_t PAD_[] =
+    const Engine & GetEngine() const
     {
-        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    };
-
-    static_assert(std::size(PAD_) == 64);
-
-    Inner_::Buffer Buffer_;
-
-    Inner_::Block Block_;
-    int_fast8_t BlockSize_;
-
-    uint32_t Word_;
-    int_fast8_t WordBytesPacked_;
+        return Engine_;
+    }
 
-    uint64_t MessageSizeBytes_;
+private:
+    MerkleDamgard<Inner_::Traits> Engine_;
+};
 
-    void ResetImpl()
-    {
-        Buffer_ = Inner_::Buffer();
-        Block_.fill(0);
+inline Md4Hash Digest(const void * data, size_t size)
+{
+    MerkleDamgard<Inner_::Traits> engine;
+    engine.Update(static_cast<const uint8_t *>(data), size);
 
-        BlockSize_ = 0;
-        Word_ = 0;
-        WordBytesPacked_ = 0;
-        MessageSizeBytes_ = 0;
-    }
+    Md4Hash result;
+    engine.Finish(result.RawDigest_.data());
 
-    template<typename InputIt>
-    uint64_t UpdateImpl(InputIt begin, InputIt end)
-    {
-        uint64_t written = 0;
-
-        for (InputIt it = begin; it != end; ++it, ++written)
-        {
-            Word_ |= (static_cast<uint32_t>(*it) << (WordBytesPacked_ * 8));
-            ++WordBytesPacked_;
-
-            if (WordBytesPacked_ == 4)
-            {
-                Block_[BlockSize_++] = Word_;
-                WordBytesPacked_ = 0;
-                Word_ = 0;
-
-                if (BlockSize_ == 16)
-                {
-                    Inner_::Algorithm::UpdateBuffer(Buffer_, Block_);
-                    BlockSize_ = 0;
-                }
-            }
-        }
-
-        return written;
-    }
-};
+    return result;
+}
 
 } // namespace Chaos::Hash::Md4
 
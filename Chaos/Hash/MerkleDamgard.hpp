@@ -0,0 +1,320 @@
+#ifndef CHAOS_HASH_MERKLEDAMGARD_HPP
+#define CHAOS_HASH_MERKLEDAMGARD_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "Service/ByteIterator.hpp"
+#include "Service/StreamStore.hpp"
+
+namespace Chaos::Hash
+{
+
+enum class ByteOrder
+{
+    LittleEndian,
+    BigEndian
+};
+
+// Traits must provide:
+//   Buffer                          chaining state with a Regs_ array of words,
+//   Block                           std::array of message words,
+//   WORD_ORDER                      order of words, length field and digest,
+//   LENGTH_SIZE_BYTES               size of the trailing message length field,
+//   Compress(Buffer &, const Block &).
+template<typename Traits>
+class MerkleDamgard
+{
+public:
+    using Buffer = typename Traits::Buffer;
+    using Block = typename Traits::Block;
+    using Word = typename Block::value_type;
+
+    static constexpr size_t BLOCK_SIZE_BYTES = std::tuple_size_v<Block> * sizeof(Word);
+    static constexpr size_t LENGTH_SIZE_BYTES = Traits::LENGTH_SIZE_BYTES;
+    static constexpr size_t DIGEST_SIZE_BYTES = sizeof(Buffer::Regs_);
+    static constexpr ByteOrder WORD_ORDER = Traits::WORD_ORDER;
+
+    static_assert(std::is_unsigned_v<Word>);
+    static_assert(LENGTH_SIZE_BYTES >= sizeof(uint64_t) && LENGTH_SIZE_BYTES < BLOCK_SIZE_BYTES);
+
+    MerkleDamgard()
+    {
+        Reset();
+    }
+
+    void Reset()
+    {
+        Buffer_ = Buffer();
+        PendingSize_ = 0;
+        MessageSizeBytes_ = 0;
+    }
+
+    template<typename InputIt>
+    void Update(InputIt begin, InputIt end)
+    {
+        if constexpr (Service::IsContiguousByteIterator<InputIt>)
+        {
+            if (begin != end)
+            {
+                Update(Service::ToBytePointer(begin), static_cast<size_t>(end - begin));
+            }
+        }
+        else
+        {
+            for (InputIt it = begin; it != end; ++it)
+            {
+                Pending_[PendingSize_++] = static_cast<uint8_t>(*it);
+                ++MessageSizeBytes_;
+
+                if (PendingSize_ == BLOCK_SIZE_BYTES)
+                {
+                    CompressBytes(Pending_);
+                    PendingSize_ = 0;
+                }
+            }
+        }
+    }
+
+    void Update(const uint8_t * data, size_t size)
+    {
+        MessageSizeBytes_ += size;
+
+        if (PendingSize_ > 0)
+        {
+            const size_t taken = std::min(size, BLOCK_SIZE_BYTES - PendingSize_);
+
+            std::memcpy(Pending_ + PendingSize_, data, taken);
+            PendingSize_ += taken;
+            data += taken;
+            size -= taken;
+
+            if (PendingSize_ < BLOCK_SIZE_BYTES)
+            {
+                return;
+            }
+
+            CompressBytes(Pending_);
+            PendingSize_ = 0;
+        }
+
+        for (; size >= BLOCK_SIZE_BYTES; size -= BLOCK_SIZE_BYTES, data += BLOCK_SIZE_BYTES)
+        {
+            CompressBytes(data);
+        }
+
+        std::memcpy(Pending_, data, size);
+        PendingSize_ = size;
+    }
+
+    template<typename OutputIt, typename InputIt>
+    OutputIt CopyAndUpdate(OutputIt out, InputIt begin, InputIt end)
+    {
+        if constexpr (Service::IsContiguousMutableByteIterator<OutputIt> &&
+                      Service::IsContiguousByteIterator<InputIt>)
+        {
+            if (begin == end)
+            {
+                return out;
+            }
+
+            const size_t size = static_cast<size_t>(end - begin);
+            CopyAndUpdate(Service::ToBytePointer(out), Service::ToBytePointer(begin), size);
+
+            return out + size;
+        }
+        else
+        {
+            uint8_t chunk[BLOCK_SIZE_BYTES];
+            size_t chunkSize = 0;
+
+            for (InputIt it = begin; it != end; ++it)
+            {
+                chunk[chunkSize++] = static_cast<uint8_t>(*it);
+
+                if (chunkSize == BLOCK_SIZE_BYTES)
+                {
+                    out = std::copy(chunk, chunk + chunkSize, out);
+                    Update(chunk, chunkSize);
+                    chunkSize = 0;
+                }
+            }
+
+            out = std::copy(chunk, chunk + chunkSize, out);
+            Update(chunk, chunkSize);
+
+            return out;
+        }
+    }
+
+    void CopyAndUpdate(uint8_t * out, const uint8_t * data, size_t size)
+    {
+        if (PendingSize_ > 0)
+        {
+            const size_t head = std::min(size, BLOCK_SIZE_BYTES - PendingSize_);
+
+            std::memcpy(out, data, head);
+            Update(data, head);
+
+            out += head;
+            data += head;
+            size -= head;
+        }
+
+        const bool nonTemporal = size >= Service::NON_TEMPORAL_THRESHOLD;
+
+        for (; size >= BLOCK_SIZE_BYTES; size -= BLOCK_SIZE_BYTES, data += BLOCK_SIZE_BYTES, out += BLOCK_SIZE_BYTES)
+        {
+            alignas(16) uint8_t block[BLOCK_SIZE_BYTES];
+            std::memcpy(block, data, BLOCK_SIZE_BYTES);
+
+            if (nonTemporal)
+            {
+                Service::StreamStore(out, block, BLOCK_SIZE_BYTES);
+            }
+            else
+            {
+                std::memcpy(out, block, BLOCK_SIZE_BYTES);
+            }
+
+            MessageSizeBytes_ += BLOCK_SIZE_BYTES;
+            CompressBytes(block);
+        }
+
+        if (nonTemporal)
+        {
+            Service::StreamFence();
+        }
+
+        std::memcpy(out, data, size);
+        Update(data, size);
+    }
+
+    void Finish(uint8_t * digest)
+    {
+        Pending_[PendingSize_++] = 0x80;
+
+        if (PendingSize_ > BLOCK_SIZE_BYTES - LENGTH_SIZE_BYTES)
+        {
+            std::fill(Pending_ + PendingSize_, Pending_ + BLOCK_SIZE_BYTES, 0);
+            CompressBytes(Pending_);
+            PendingSize_ = 0;
+        }
+
+        std::fill(Pending_ + PendingSize_, Pending_ + BLOCK_SIZE_BYTES - sizeof(uint64_t), 0);
+        StoreLength(Pending_, MessageSizeBytes_);
+
+        CompressBytes(Pending_);
+        PendingSize_ = 0;
+
+        for (const Word & reg : Buffer_.Regs_)
+        {
+            StoreWord(digest, reg);
+            digest += sizeof(Word);
+        }
+    }
+
+    uint64_t GetMessageSize() const
+    {
+        return MessageSizeBytes_;
+    }
+
+    // Chaining state; it covers the whole message only when the message
+    // size is a multiple of BLOCK_SIZE_BYTES.
+    const Buffer & GetBuffer() const
+    {
+        return Buffer_;
+    }
+
+    static void Compress(Buffer & buffer, const Block & block)
+    {
+        Traits::Compress(buffer, block);
+    }
+
+    static Word LoadWord(const uint8_t * bytes)
+    {
+        return LoadWordImpl(bytes, std::make_index_sequence<sizeof(Word)>());
+    }
+
+    static void StoreWord(uint8_t * bytes, Word word)
+    {
+        StoreWordImpl(bytes, word, std::make_index_sequence<sizeof(Word)>());
+    }
+
+    static void LoadBlock(Block & block, const uint8_t * bytes)
+    {
+        for (size_t i = 0; i < std::tuple_size_v<Block>; ++i, bytes += sizeof(Word))
+        {
+            block[i] = LoadWord(bytes);
+        }
+    }
+
+    // The padded last block of a message whose first prefixSizeBytes bytes
+    // are already compressed and whose payloadSizeBytes remaining bytes open
+    // the block. The payload words are left zero for the caller to fill in,
+    // which lets fixed-size messages reuse one block.
+    static Block MakeFinalBlock(uint64_t prefixSizeBytes, size_t payloadSizeBytes)
+    {
+        uint8_t bytes[BLOCK_SIZE_BYTES] = {};
+        bytes[payloadSizeBytes] = 0x80;
+        StoreLength(bytes, prefixSizeBytes + payloadSizeBytes);
+
+        Block result;
+        LoadBlock(result, bytes);
+
+        return result;
+    }
+
+private:
+    Buffer Buffer_;
+
+    uint8_t Pending_[BLOCK_SIZE_BYTES];
+    size_t PendingSize_;
+
+    uint64_t MessageSizeBytes_;
+
+    static constexpr size_t Shift(size_t i)
+    {
+        return Traits::WORD_ORDER == ByteOrder::BigEndian ? (sizeof(Word) - 1 - i) * 8 : i * 8;
+    }
+
+    template<size_t... I>
+    static Word LoadWordImpl(const uint8_t * bytes, std::index_sequence<I...>)
+    {
+        return ((static_cast<Word>(bytes[I]) << Shift(I)) | ...);
+    }
+
+    template<size_t... I>
+    static void StoreWordImpl(uint8_t * bytes, Word word, std::index_sequence<I...>)
+    {
+        ((bytes[I] = static_cast<uint8_t>((word >> Shift(I)) & 0xFF)), ...);
+    }
+
+    // Message bit length in the last 8 bytes of a block; the rest of a
+    // wider length field is left to the caller's zero fill.
+    static void StoreLength(uint8_t * block, uint64_t messageSizeBytes)
+    {
+        const uint64_t messageSizeBits = messageSizeBytes * 8;
+        uint8_t * length = block + BLOCK_SIZE_BYTES - sizeof(uint64_t);
+
+        for (size_t i = 0; i < sizeof(uint64_t); ++i)
+        {
+            const size_t shift = Traits::WORD_ORDER == ByteOrder::BigEndian ? 56 - i * 8 : i * 8;
+            length[i] = static_cast<uint8_t>((messageSizeBits >> shift) & 0xFF);
+        }
+    }
+
+    void CompressBytes(const uint8_t * bytes)
+    {
+        Block block;
+        LoadBlock(block, bytes);
+        Traits::Compress(Buffer_, block);
+    }
+};
+
+} // namespace Chaos::Hash
+
+#endif // CHAOS_HASH_MERKLEDAMGARD_HPP
@@ -0,0 +1,191 @@
+#ifndef CHAOS_HASH_MULTIHASHER_HPP
+#define CHAOS_HASH_MULTIHASHER_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+#include "Hasher.hpp"
+#include "Service/ByteIterator.hpp"
+
+namespace Chaos::Hash
+{
+
+template<typename... Hashers>
+class MultiHasher : public Hasher<MultiHasher<Hashers...>>
+{
+public:
+    static_assert(sizeof...(Hashers) > 0);
+    static_assert((std::is_base_of_v<Hasher<Hashers>, Hashers> && ...));
+
+    using HashType = std::tuple<typename Hashers::HashType...>;
+
+    static constexpr size_t CHUNK_SIZE_BYTES = 1024;
+    static constexpr size_t NO_PARALLEL_THRESHOLD = std::numeric_limits<size_t>::max();
+
+    MultiHasher()
+        : ParallelThreshold_(NO_PARALLEL_THRESHOLD)
+    { }
+
+    explicit MultiHasher(size_t parallelThresholdBytes)
+        : ParallelThreshold_(parallelThresholdBytes)
+    { }
+
+    using Hasher<MultiHasher<Hashers...>>::Update;
+
+    void Reset()
+    {
+        std::apply([](auto &... hashers) { (hashers.Reset(), ...); }, Hashers_);
+    }
+
+    template<typename InputIt>
+    void Update(InputIt begin, InputIt end)
+    {
+        if constexpr (Service::IsContiguousByteIterator<InputIt>)
+        {
+            if (begin != end)
+            {
+                UpdateContiguous(Service::ToBytePointer(begin), static_cast<size_t>(end - begin));
+            }
+        }
+        else
+        {
+            std::array<uint8_t, CHUNK_SIZE_BYTES> chunk;
+            size_t chunkSize = 0;
+
+            for (InputIt it = begin; it != end; ++it)
+            {
+                chunk[chunkSize++] = static_cast<uint8_t>(*it);
+
+                if (chunkSize == chunk.size())
+                {
+                    UpdateChunked(chunk.data(), chunkSize);
+                    chunkSize = 0;
+                }
+            }
+
+            UpdateChunked(chunk.data(), chunkSize);
+        }
+    }
+
+    template<typename OutputIt, typename InputIt>
+    OutputIt CopyAndUpdate(OutputIt out, InputIt begin, InputIt end)
+    {
+        if constexpr (Service::IsContiguousMutableByteIterator<OutputIt> &&
+                      Service::IsContiguousByteIterator<InputIt>)
+        {
+            if (begin == end)
+            {
+                return out;
+            }
+
+            const size_t size = static_cast<size_t>(end - begin);
+            const uint8_t * data = Service::ToBytePointer(begin);
+
+            std::copy(data, data + size, Service::ToBytePointer(out));
+            UpdateContiguous(data, size);
+
+            return out + size;
+        }
+        else
+        {
+            std::array<uint8_t, CHUNK_SIZE_BYTES> chunk;
+            size_t chunkSize = 0;
+
+            for (InputIt it = begin; it != end; ++it)
+            {
+                chunk[chunkSize++] = static_cast<uint8_t>(*it);
+
+                if (chunkSize == chunk.size())
+                {
+                    out = std::copy(chunk.data(), chunk.data() + chunkSize, out);
+                    UpdateChunked(chunk.data(), chunkSize);
+                    chunkSize = 0;
+                }
+            }
+
+            out = std::copy(chunk.data(), chunk.data() + chunkSize, out);
+            UpdateChunked(chunk.data(), chunkSize);
+
+            return out;
+        }
+    }
+
+    HashType Finish()
+    {
+        return std::apply([](auto &... hashers) { return HashType(hashers.Finish()...); }, Hashers_);
+    }
+
+    size_t GetParallelThreshold() const
+    {
+        return ParallelThreshold_;
+    }
+
+    void SetParallelThreshold(size_t parallelThresholdBytes)
+    {
+        ParallelThreshold_ = parallelThresholdBytes;
+    }
+
+private:
+    std::tuple<Hashers...> Hashers_;
+    size_t ParallelThreshold_;
+
+    void UpdateContiguous(const uint8_t * data, size_t size)
+    {
+        if constexpr (sizeof...(Hashers) > 1)
+        {
+            if (size >= ParallelThreshold_)
+            {
+                UpdateParallel(data, size);
+                return;
+            }
+        }
+
+        UpdateChunked(data, size);
+    }
+
+    void UpdateChunked(const uint8_t * data, size_t size)
+    {
+        while (size > 0)
+        {
+            const size_t chunkSize = std::min(size, CHUNK_SIZE_BYTES);
+
+            std::apply([data, chunkSize](auto &... hashers)
+                       {
+                           (hashers.Update(data, data + chunkSize), ...);
+                       },
+                       Hashers_);
+
+            data += chunkSize;
+            size -= chunkSize;
+        }
+    }
+
+    void UpdateParallel(const uint8_t * data, size_t size)
+    {
+        std::apply([data, size](auto & first, auto &... rest)
+                   {
+                       std::future<void> workers[] =
+                       {
+                           std::async(std::launch::async,
+                                      [&rest, data, size]() { rest.Update(data, data + size); })...
+                       };
+
+                       first.Update(data, data + size);
+
+                       for (std::future<void> & worker : workers)
+                       {
+                           worker.get();
+                       }
+                   },
+                   Hashers_);
+    }
+};
+
+} // namespace Chaos::Hash
+
+#endif // CHAOS_HASH_MULTIHASHER_HPP
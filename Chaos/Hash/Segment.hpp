@@ -0,0 +1,39 @@
+#ifndef CHAOS_HASH_SEGMENT_HPP
+#define CHAOS_HASH_SEGMENT_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace Chaos::Hash
+{
+
+struct Segment
+{
+    const void * Data;
+    size_t Size;
+};
+
+namespace Inner_
+{
+
+template<typename T, typename = void>
+struct IsSegmentRange : std::false_type
+{
+};
+
+template<typename T>
+struct IsSegmentRange<T, std::void_t<decltype(std::begin(std::declval<const T &>())),
+                                     decltype(std::end(std::declval<const T &>()))>>
+    : std::is_convertible<decltype(*std::begin(std::declval<const T &>())), const Segment &>
+{
+};
+
+} // namespace Inner_
+
+template<typename T>
+inline constexpr bool IsSegmentRange = Inner_::IsSegmentRange<T>::value;
+
+} // namespace Chaos::Hash
+
+#endif // CHAOS_HASH_SEGMENT_HPP
@@ -7,6 +7,11 @@
 
 #include "Hash.hpp"
 #include "Hasher.hpp"
+#include "MerkleDamgard.hpp"
+
+#ifdef CHAOS_WITH_BACKENDS
+#include "Cpu/Dispatch.hpp"
+#endif
 
 namespace Chaos::Hash::Sha1::Inner_
 {
@@ -23,10 +28,9 @@ struct Algorithm
 public:
     static void UpdateBuffer(Buffer & buffer, const Block & block)
     {
-        static_assert(std::tuple_size_v<ScheduledBlock> == 80);
+        static_assert(std::tuple_size_v<Block> == 16);
 
-        ScheduledBlock scheduled;
-        ScheduleBlock(scheduled, block);
+        Block w = block;
 
         uint32_t a = buffer.Regs_[0];
         uint32_t b = buffer.Regs_[1];
@@ -34,25 +38,101 @@ public:
         uint32_t d = buffer.Regs_[3];
         uint32_t e = buffer.Regs_[4];
 
-        for (int_fast8_t i = 0; i < 20; ++i)
-        {
-            PerformRound(a, b, c, d, e, F0, scheduled[i], 0x5a827999);
-        }
-
-        for (int_fast8_t i = 20; i < 40; ++i)
-        {
-            PerformRound(a, b, c, d, e, F20, scheduled[i], 0x6ed9eba1);
-        }
-
-        for (int_fast8_t i = 40; i < 60; ++i)
-        {
-            PerformRound(a, b, c, d, e, F40, scheduled[i], 0x8f1bbcdc);
-        }
-
-        for (int_fast8_t i = 60; i < 80; ++i)
-        {
-            PerformRound(a, b, c, d, e, F60, scheduled[i], 0xca62c1d6);
-        }
+        Round< 0>(a, b, c, d, e, w);
+        Round< 1>(e, a, b, c, d, w);
+        Round< 2>(d, e, a, b, c, w);
+        Round< 3>(c, d, e, a, b, w);
+        Round< 4>(b, c, d, e, a, w);
+
+        Round< 5>(a, b, c, d, e, w);
+        Round< 6>(e, a, b, c, d, w);
+        Round< 7>(d, e, a, b, c, w);
+        Round< 8>(c, d, e, a, b, w);
+        Round< 9>(b, c, d, e, a, w);
+
+        Round<10>(a, b, c, d, e, w);
+        Round<11>(e, a, b, c, d, w);
+        Round<12>(d, e, a, b, c, w);
+        Round<13>(c, d, e, a, b, w);
+        Round<14>(b, c, d, e, a, w);
+
+        Round<15>(a, b, c, d, e, w);
+        Round<16>(e, a, b, c, d, w);
+        Round<17>(d, e, a, b, c, w);
+        Round<18>(c, d, e, a, b, w);
+        Round<19>(b, c, d, e, a, w);
+
+        Round<20>(a, b, c, d, e, w);
+        Round<21>(e, a, b, c, d, w);
+        Round<22>(d, e, a, b, c, w);
+        Round<23>(c, d, e, a, b, w);
+        Round<24>(b, c, d, e, a, w);
+
+        Round<25>(a, b, c, d, e, w);
+        Round<26>(e, a, b, c, d, w);
+        Round<27>(d, e, a, b, c, w);
+        Round<28>(c, d, e, a, b, w);
+        Round<29>(b, c, d, e, a, w);
+
+        Round<30>(a, b, c, d, e, w);
+        Round<31>(e, a, b, c, d, w);
+        Round<32>(d, e, a, b, c, w);
+        Round<33>(c, d, e, a, b, w);
+        Round<34>(b, c, d, e, a, w);
+
+        Round<35>(a, b, c, d, e, w);
+        Round<36>(e, a, b, c, d, w);
+        Round<37>(d, e, a, b, c, w);
+        Round<38>(c, d, e, a, b, w);
+        Round<39>(b, c, d, e, a, w);
+
+        Round<40>(a, b, c, d, e, w);
+        Round<41>(e, a, b, c, d, w);
+        Round<42>(d, e, a, b, c, w);
+        Round<43>(c, d, e, a, b, w);
+        Round<44>(b, c, d, e, a, w);
+
+        Round<45>(a, b, c, d, e, w);
+        Round<46>(e, a, b, c, d, w);
+        Round<47>(d, e, a, b, c, w);
+        Round<48>(c, d, e, a, b, w);
+        Round<49>(b, c, d, e, a, w);
+
+        Round<50>(a, b, c, d, e, w);
+        Round<51>(e, a, b, c, d, w);
+        Round<52>(d, e, a, b, c, w);
+        Round<53>(c, d, e, a, b, w);
+        Round<54>(b, c, d, e, a, w);
+
+        Round<55>(a, b, c, d, e, w);
+        Round<56>(e, a, b, c, d, w);
+        Round<57>(d, e, a, b, c, w);
+        Round<58>(c, d, e, a, b, w);
+        Round<59>(b, c, d, e, a, w);
+
+        Round<60>(a, b, c, d, e, w);
+        Round<61>(e, a, b, c, d, w);
+        Round<62>(d, e, a, b, c, w);
+        Round<63>(c, d, e, a, b, w);
+        Round<64>(b, c, d, e, a, w);
+
+        Round<65>(a, b, c, d, e, w);
+        Round<66>(e, a, b, c, d, w);
+        Round<67>(d, e, a, b, c, w);
+        Round<68>(c, d, e, a, b, w);
+        Round<69>(b, c, d, e, a, w);
+
+        Round<70>(a, b, c, d, e, w);
+        Round<71>(e, a, b, c, d, w);
+        Round<72>(d, e, a, b, c, w);
+        Round<73>(c, d, e, a, b, w);
+        Round<74>(b, c, d, e, a, w);
+
+        Round<75>(a, b, c, d, e, w);
+        Round<76>(e, a, b, c, d, w);
+        Round<77>(d, e, a, b, c, w);
+        Round<78>(c, d, e, a, b, w);
+        Round<79>(b, c, d, e, a, w);
 
         buffer.Regs_[0] += a;
         buffer.Regs_[1] += b;
@@ -62,61 +142,120 @@ public:
     }
 
 private:
-    using ScheduledBlock = std::array<uint32_t, 80>;
-    using RoundFunction = uint32_t (*)(uint32_t b, uint32_t c, uint32_t d);
-
     static uint32_t Rotl(uint32_t v, int_fast8_t s)
     {
         return (v << s) | (v >> (32 - s));
     }
 
-    static uint32_t F0(uint32_t b, uint32_t c, uint32_t d)
+    template<int_fast8_t T>
+    static uint32_t F(uint32_t b, uint32_t c, uint32_t d)
     {
-        return (b & c) | ((~b) & d);
+        if constexpr (T < 20)
+        {
+            return d ^ (b & (c ^ d));
+        }
+        else if constexpr (T < 40)
+        {
+            return b ^ c ^ d;
+        }
+        else if constexpr (T < 60)
+        {
+            return (b & c) | (d & (b | c));
+        }
+        else
+        {
+            return b ^ c ^ d;
+        }
     }
 
-    static uint32_t F20(uint32_t b, uint32_t c, uint32_t d)
+    template<int_fast8_t T>
+    static constexpr uint32_t K()
     {
-        return b ^ c ^ d;
+        if constexpr (T < 20)
+        {
+            return 0x5a827999;
+        }
+        else if constexpr (T < 40)
+        {
+            return 0x6ed9eba1;
+        }
+        else if constexpr (T < 60)
+        {
+            return 0x8f1bbcdc;
+        }
+        else
+        {
+            return 0xca62c1d6;
+        }
     }
 
-    static uint32_t F40(uint32_t b, uint32_t c, uint32_t d)
+    template<int_fast8_t T>
+    static void Round(uint32_t a, uint32_t & b, uint32_t c, uint32_t d, uint32_t & e,
+                      Block & w)
     {
-        return (b & c) | (b & d) | (c & d);
-    }
+        static_assert(T >= 0 && T < 80);
 
-    static uint32_t F60(uint32_t b, uint32_t c, uint32_t d)
-    {
-        return b ^ c ^ d;
+        if constexpr (T >= 16)
+        {
+            w[T & 15] = Rotl(w[(T - 3) & 15] ^
+                             w[(T - 8) & 15] ^
+                             w[(T - 14) & 15] ^
+                             w[T & 15], 1);
+        }
+
+        e += Rotl(a, 5) + F<T>(b, c, d) + K<T>() + w[T & 15];
+        b = Rotl(b, 30);
     }
+};
 
-    static void ScheduleBlock(ScheduledBlock & result, const Block & block)
-    {
-        static_assert(std::tuple_size_v<Block> == 16);
-        static_assert(std::tuple_size_v<ScheduledBlock> == 80);
+#ifdef CHAOS_WITH_BACKENDS
 
-        std::copy(block.begin(), block.end(), result.begin());
+void UpdateBufferVex128(uint32_t * regs, const uint32_t * words);
+void UpdateBufferShaNi(uint32_t * regs, const uint32_t * words);
 
-        for (int_fast8_t t = 16; t < 80; ++t)
-        {
-            result[t] = Rotl(result[t - 3] ^
-                             result[t - 8] ^
-                             result[t - 14] ^
-                             result[t - 16], 1);
-        }
-    }
+#endif
 
-    static void PerformRound(uint32_t & a, uint32_t & b, uint32_t & c,
-                             uint32_t & d, uint32_t & e,
-                             RoundFunction func, uint32_t data, uint32_t k)
+inline void UpdateBuffer(Buffer & buffer, const Block & block)
+{
+#ifdef CHAOS_WITH_BACKENDS
+    using UpdateBufferFn = void (*)(Buffer & buffer, const Block & block);
+
+    static const Cpu::Dispatcher<UpdateBufferFn> dispatcher(
     {
-        const uint32_t temp = Rotl(a, 5) + func(b, c, d) + e + data + k;
+        {
+            Cpu::Backend::ShaNi,
+            [](Buffer & buffer, const Block & block)
+            {
+                UpdateBufferShaNi(buffer.Regs_, block.data());
+            }
+        },
+        {
+            Cpu::Backend::Avx2,
+            [](Buffer & buffer, const Block & block)
+            {
+                UpdateBufferVex128(buffer.Regs_, block.data());
+            }
+        },
+        { Cpu::Backend::Portable, Algorithm::UpdateBuffer }
+    });
+
+    dispatcher.Get()(buffer, block);
+#else
+    Algorithm::UpdateBuffer(buffer, block);
+#endif
+}
 
-        e = d;
-        d = c;
-        c = Rotl(b, 30);
-        b = a;
-        a = temp;
+struct Traits
+{
+    using Buffer = Inner_::Buffer;
+    using Block = Inner_::Block;
+
+    static constexpr ByteOrder WORD_ORDER = ByteOrder::BigEndian;
+    static constexpr size_t LENGTH_SIZE_BYTES = 8;
+
+    static void Compress(Buffer & buffer, const Block & block)
+    {
+        UpdateBuffer(buffer, block);
     }
 };
 
@@ -155,142 +294,58 @@ class Sha1Hasher : public Hasher<Sha1Hasher>
 {
 public:
     using HashType = Sha1Hash;
+    using Engine = MerkleDamgard<Inner_::Traits>;
 
-    static constexpr size_t BLOCK_SIZE_BYTES = 64;
+    static constexpr size_t BLOCK_SIZE_BYTES = MerkleDamgard<Inner_::Traits>::BLOCK_SIZE_BYTES;
 
-    Sha1Hasher()
-    {
-        ResetImpl();
-    }
+    Sha1Hasher() = default;
+
+    using Hasher<Sha1Hasher>::Update;
 
     void Reset()
     {
-        ResetImpl();
+        Engine_.Reset();
     }
 
     template<typename InputIt>
     void Update(InputIt begin, InputIt end)
     {
-        MessageSizeBytes_ += UpdateImpl(begin, end);
+        Engine_.Update(begin, end);
     }
 
-    HashType Finish()
+    template<typename OutputIt, typename InputIt>
+    OutputIt CopyAndUpdate(OutputIt out, InputIt begin, InputIt end)
     {
-        uint64_t messageSizeBytesMod64 = MessageSizeBytes_ % 64;
-
-        int_fast8_t paddingNeededBytes;
-
-        if (messageSizeBytesMod64 < 56)
-        {
-            paddingNeededBytes = 56 - messageSizeBytesMod64;
-        }
-        else if (messageSizeBytesMod64 > 56)
-        {
-            paddingNeededBytes = 120 - messageSizeBytesMod64;
-        }
-        else
-        {
-            paddingNeededBytes = 64;
-        }
-
-        UpdateImpl(PAD_, PAD_ + paddingNeededBytes);
-
-        const uint64_t messageSizeBits = MessageSizeBytes_ * 8;
-
-        uint8_t encodedMessageSizeBits[] =
-        {
-            static_cast<uint8_t>((messageSizeBits >> 56) & 0xFF),
-            static_cast<uint8_t>((messageSizeBits >> 48) & 0xFF),
-            static_cast<uint8_t>((messageSizeBits >> 40) & 0xFF),
-            static_cast<uint8_t>((messageSizeBits >> 32) & 0xFF),
-            static_cast<uint8_t>((messageSizeBits >> 24) & 0xFF),
-            static_cast<uint8_t>((messageSizeBits >> 16) & 0xFF),
-            static_cast<uint8_t>((messageSizeBits >>  8) & 0xFF),
-            static_cast<uint8_t>((messageSizeBits >>  0) & 0xFF),
-        };
-
-        static_assert(std::size(encodedMessageSizeBits) == 8);
-
-        UpdateImpl(encodedMessageSizeBits,
-                   encodedMessageSizeBits + std::size(encodedMessageSizeBits));
+        return Engine_.CopyAndUpdate(out, begin, end);
+    }
 
+    HashType Finish()
+    {
         HashType result;
-
-        int_fast8_t i = 0;
-        for (int_fast8_t reg = 0; reg < 5; ++reg)
-        {
-            for (int_fast8_t shift = 0; shift < 32; shift += 8)
-            {
-                result.RawDigest_[i++] = (Buffer_.Regs_[reg] >> (24 - shift)) & 0xFF;
-            }
-        }
+        Engine_.Finish(result.RawDigest_.data());
 
         return result;
     }
 
-private:
-    static constexpr uint8_t PAD_[] =
-    {
-        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    };
-
-    static_assert(std::size(PAD_) == 64);
-
-    Inner_::Buffer Buffer_;
-
-    Inner_::Block Block_;
-    int_fast8_t BlockSize_;
-
-    uint32_t Word_;
-    int_fast8_t WordBytesPacked_;
-
-    uint64_t MessageSizeBytes_;
-
-    void ResetImpl()
+    const Engine & GetEngine() const
     {
-        Buffer_ = Inner_::Buffer();
-        Block_.fill(0);
-
-        BlockSize_ = 0;
-        Word_ = 0;
-        WordBytesPacked_ = 0;
-        MessageSizeBytes_ = 0;
+        return Engine_;
     }
 
-    template<typename InputIt>
-    uint64_t UpdateImpl(InputIt begin, InputIt end)
-    {
-        uint64_t written = 0;
+private:
+    MerkleDamgard<Inner_::Traits> Engine_;
+};
 
-        for (InputIt it = begin; it != end; ++it, ++written)
-        {
-            Word_ |= (static_cast<uint32_t>(*it) << (24 - (WordBytesPacked_ * 8)));
-            ++WordBytesPacked_;
+inline Sha1Hash Digest(const void * data, size_t size)
+{
+    MerkleDamgard<Inner_::Traits> engine;
+    engine.Update(static_cast<const uint8_t *>(data), size);
 
-            if (WordBytesPacked_ == 4)
-            {
-                Block_[BlockSize_++] = Word_;
-                WordBytesPacked_ = 0;
-                Word_ = 0;
-
-                if (BlockSize_ == 16)
-                {
-                    Inner_::Algorithm::UpdateBuffer(Buffer_, Block_);
-                    BlockSize_ = 0;
-                }
-            }
-        }
+    Sha1Hash result;
+    engine.Finish(result.RawDigest_.data());
 
-        return written;
-    }
-};
+    return result;
+}
 
 } // namespace Chaos::Hash::Sha1
 
@@ -0,0 +1,326 @@
+#ifndef CHAOS_KDF_DUKPT_HPP
+#define CHAOS_KDF_DUKPT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+#include "Cipher/Block/Block64.hpp"
+#include "Cipher/Block/Des/Des3Crypt.hpp"
+#include "Cipher/Block/Des/DesCrypt.hpp"
+#include "Service/ChaosException.hpp"
+#include "Service/SeArray.hpp"
+#include "Service/SecureErase.hpp"
+
+namespace Chaos::Kdf::Dukpt
+{
+
+using Ksn = std::array<uint8_t, 10>;
+using Key = std::array<uint8_t, 16>;
+
+inline constexpr uint32_t MAX_COUNTER = 0x1fffff;
+inline constexpr int_fast8_t COUNTER_BITS = 21;
+
+enum class KeyUsage
+{
+    Pin,
+    MacRequest,
+    MacResponse,
+    DataRequest,
+    DataResponse
+};
+
+} // namespace Chaos::Kdf::Dukpt
+
+namespace Chaos::Kdf::Dukpt::Inner_
+{
+
+inline constexpr uint64_t KEY_MASK = 0xc0c0c0c000000000;
+
+inline uint32_t LoadCounter(const Ksn & ksn)
+{
+    return ((static_cast<uint32_t>(ksn[7]) << 16) | (static_cast<uint32_t>(ksn[8]) << 8) | ksn[9]) & MAX_COUNTER;
+}
+
+inline Ksn ClearCounter(Ksn ksn)
+{
+    ksn[7] &= static_cast<uint8_t>(~(MAX_COUNTER >> 16));
+    ksn[8] = 0;
+    ksn[9] = 0;
+
+    return ksn;
+}
+
+inline uint64_t GetVariantMask(KeyUsage usage)
+{
+    switch (usage)
+    {
+    case KeyUsage::Pin:
+        return 0x00000000000000ff;
+    case KeyUsage::MacRequest:
+        return 0x000000000000ff00;
+    case KeyUsage::MacResponse:
+        return 0x00000000ff000000;
+    case KeyUsage::DataRequest:
+        return 0x0000000000ff0000;
+    case KeyUsage::DataResponse:
+        return 0x000000ff00000000;
+    }
+
+    throw Service::ChaosException("Dukpt: invalid key usage");
+}
+
+inline Key StoreKey(uint64_t left, uint64_t right)
+{
+    Key result;
+
+    Cipher::Block::Inner_::StoreBlock64(result.data(), left);
+    Cipher::Block::Inner_::StoreBlock64(result.data() + 8, right);
+
+    return result;
+}
+
+inline uint64_t EncryptDes(uint64_t key, uint64_t block)
+{
+    std::array<uint8_t, 8> keyBytes;
+    Cipher::Block::Inner_::StoreBlock64(keyBytes.data(), key);
+
+    const Cipher::Block::Des::DesCrypt::DesEncryptor encryptor(
+        Cipher::Block::Des::DesCrypt::Key(keyBytes.begin(), keyBytes.end()));
+
+    Service::SecureErase(keyBytes.data(), keyBytes.size());
+
+    return encryptor.EncryptBlock(block);
+}
+
+// The non-reversible key generation process of ANSI X9.24-1 A.2; key is
+// updated in place.
+inline void GenerateKey(uint64_t & left, uint64_t & right, uint64_t data)
+{
+    const uint64_t newRight = EncryptDes(left, data ^ right) ^ right;
+
+    const uint64_t maskedLeft = left ^ KEY_MASK;
+    const uint64_t maskedRight = right ^ KEY_MASK;
+
+    left = EncryptDes(maskedLeft, data ^ maskedRight) ^ maskedRight;
+    right = newRight;
+}
+
+} // namespace Chaos::Kdf::Dukpt::Inner_
+
+namespace Chaos::Kdf::Dukpt
+{
+
+// Transaction key derivation for one device, i.e. one IPEK and initial KSN.
+// The chain of intermediate keys for the last counter is kept: the next
+// counter only redoes the steps below the highest bit in which it differs,
+// which for sequential transactions is one or two of the up to 21 steps.
+class KeyChain
+{
+public:
+    KeyChain(const Key & ipek, const Ksn & ksn)
+        : InitialKsn_(Inner_::ClearCounter(ksn)),
+          KsnRegister_(Cipher::Block::Inner_::LoadBlock64(InitialKsn_.data() + 2)),
+          Counter_(0),
+          Depth_(0)
+    {
+        Path_[0] = Cipher::Block::Inner_::LoadBlock64(ipek.data());
+        Path_[1] = Cipher::Block::Inner_::LoadBlock64(ipek.data() + 8);
+    }
+
+    // True if ksn belongs to this device, whatever its counter.
+    bool Matches(const Ksn & ksn) const
+    {
+        return Inner_::ClearCounter(ksn) == InitialKsn_;
+    }
+
+    Key DeriveTransactionKey(uint32_t counter)
+    {
+        Advance(counter);
+
+        return Inner_::StoreKey(Path_[2 * Depth_], Path_[2 * Depth_ + 1]);
+    }
+
+    Key DeriveKey(uint32_t counter, KeyUsage usage)
+    {
+        Advance(counter);
+
+        const uint64_t mask = Inner_::GetVariantMask(usage);
+        Key result = Inner_::StoreKey(Path_[2 * Depth_] ^ mask, Path_[2 * Depth_ + 1] ^ mask);
+
+        if (usage == KeyUsage::DataRequest || usage == KeyUsage::DataResponse)
+        {
+            const Cipher::Block::Des::Des3Crypt::Des3Encryptor encryptor(
+                Cipher::Block::Des::Des3Crypt::Key(result.begin(), result.end()));
+
+            const uint64_t left = encryptor.EncryptBlock(Cipher::Block::Inner_::LoadBlock64(result.data()));
+            const uint64_t right = encryptor.EncryptBlock(Cipher::Block::Inner_::LoadBlock64(result.data() + 8));
+
+            result = Inner_::StoreKey(left, right);
+        }
+
+        return result;
+    }
+
+private:
+    Ksn InitialKsn_;
+    uint64_t KsnRegister_;
+
+    uint32_t Counter_;
+    size_t Depth_;
+
+    // Path_[2 * i] and Path_[2 * i + 1] are the key halves after the i-th
+    // set counter bit; Path_[0..1] is the IPEK.
+    Service::SeArray<uint64_t, 2 * (COUNTER_BITS + 1)> Path_;
+
+    void Advance(uint32_t counter)
+    {
+        if (counter > MAX_COUNTER)
+        {
+            throw Service::ChaosException("Dukpt::KeyChain: counter is out of range");
+        }
+
+        bool isShared = true;
+        size_t depth = 0;
+
+        for (uint32_t bit = static_cast<uint32_t>(1) << (COUNTER_BITS - 1); bit != 0; bit >>= 1)
+        {
+            if (((counter ^ Counter_) & bit) != 0)
+            {
+                isShared = false;
+            }
+
+            if ((counter & bit) == 0)
+            {
+                continue;
+            }
+
+            ++depth;
+
+            if (!isShared)
+            {
+                uint64_t left = Path_[2 * (depth - 1)];
+                uint64_t right = Path_[2 * (depth - 1) + 1];
+
+                Inner_::GenerateKey(left, right, KsnRegister_ | (counter & ~(bit - 1)));
+
+                Path_[2 * depth] = left;
+                Path_[2 * depth + 1] = right;
+            }
+        }
+
+        Counter_ = counter;
+        Depth_ = depth;
+    }
+};
+
+// Double-length TDES base derivation key. The BDK and its C0C0C0C0 variant
+// are both scheduled once, so each IPEK costs two TDES block encryptions.
+class Bdk
+{
+public:
+    static constexpr size_t KEY_SIZE_BYTES = 16;
+
+    template<typename InputIt>
+    Bdk(InputIt keyBegin, InputIt keyEnd)
+        : Bdk(LoadKey(keyBegin, keyEnd))
+    { }
+
+    Key DeriveIpek(const Ksn & ksn) const
+    {
+        const uint64_t block = Cipher::Block::Inner_::LoadBlock64(Inner_::ClearCounter(ksn).data());
+
+        return Inner_::StoreKey(Encryptor_.EncryptBlock(block), MaskedEncryptor_.EncryptBlock(block));
+    }
+
+    KeyChain MakeKeyChain(const Ksn & ksn) const
+    {
+        Key ipek = DeriveIpek(ksn);
+        KeyChain result(ipek, ksn);
+
+        Service::SecureErase(ipek.data(), ipek.size());
+
+        return result;
+    }
+
+    // Derives the key for every KSN in ksns. Requests are processed sorted by
+    // initial KSN and counter, so each device's IPEK is derived once and
+    // neighbouring counters share their intermediate keys.
+    void DeriveKeys(const Ksn * ksns, size_t count, KeyUsage usage, Key * results) const
+    {
+        std::vector<size_t> order(count);
+        std::iota(order.begin(), order.end(), 0);
+
+        std::sort(order.begin(), order.end(), [ksns](size_t lhs, size_t rhs)
+                  {
+                      return ksns[lhs] < ksns[rhs];
+                  });
+
+        std::optional<KeyChain> chain;
+
+        for (size_t i : order)
+        {
+            if (!chain || !chain->Matches(ksns[i]))
+            {
+                chain.emplace(MakeKeyChain(ksns[i]));
+            }
+
+            results[i] = chain->DeriveKey(Inner_::LoadCounter(ksns[i]), usage);
+        }
+    }
+
+private:
+    using KeyType = std::array<uint8_t, KEY_SIZE_BYTES>;
+
+    Cipher::Block::Des::Des3Crypt::Des3Encryptor Encryptor_;
+    Cipher::Block::Des::Des3Crypt::Des3Encryptor MaskedEncryptor_;
+
+    explicit Bdk(KeyType key)
+        : Encryptor_(Cipher::Block::Des::Des3Crypt::Key(key.begin(), key.end())),
+          MaskedEncryptor_(MakeMaskedEncryptor(key))
+    {
+        Service::SecureErase(key.data(), key.size());
+    }
+
+    template<typename InputIt>
+    static KeyType LoadKey(InputIt keyBegin, InputIt keyEnd)
+    {
+        KeyType result;
+
+        size_t i = 0;
+        InputIt it = keyBegin;
+        for (; i < result.size() && it != keyEnd; ++i, ++it)
+        {
+            result[i] = static_cast<uint8_t>(*it);
+        }
+
+        if (i != result.size() || it != keyEnd)
+        {
+            throw Service::ChaosException("Dukpt::Bdk: invalid key length (16 bytes required)");
+        }
+
+        return result;
+    }
+
+    static Cipher::Block::Des::Des3Crypt::Des3Encryptor MakeMaskedEncryptor(const KeyType & key)
+    {
+        KeyType masked = Inner_::StoreKey(Cipher::Block::Inner_::LoadBlock64(key.data()) ^ Inner_::KEY_MASK,
+                                          Cipher::Block::Inner_::LoadBlock64(key.data() + 8) ^ Inner_::KEY_MASK);
+
+        Cipher::Block::Des::Des3Crypt::Des3Encryptor result(
+            Cipher::Block::Des::Des3Crypt::Key(masked.begin(), masked.end()));
+
+        Service::SecureErase(masked.data(), masked.size());
+
+        return result;
+    }
+};
+
+} // namespace Chaos::Kdf::Dukpt
+
+#endif // CHAOS_KDF_DUKPT_HPP
@@ -0,0 +1,210 @@
+#ifndef CHAOS_KDF_PBKDF2_HPP
+#define CHAOS_KDF_PBKDF2_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include "Hash/Hasher.hpp"
+#include "Hash/MerkleDamgard.hpp"
+#include "Mac/Hmac.hpp"
+#include "Service/ChaosException.hpp"
+#include "Service/SecureErase.hpp"
+
+namespace Chaos::Kdf::Pbkdf2
+{
+
+template<typename HasherImpl,
+         typename = std::enable_if_t<std::is_base_of_v<Hash::Hasher<HasherImpl>, HasherImpl>>>
+class Pbkdf2
+{
+public:
+    using Engine = typename HasherImpl::Engine;
+
+    static constexpr size_t DIGEST_SIZE_BYTES = Engine::DIGEST_SIZE_BYTES;
+    static constexpr size_t LANE_COUNT = 4;
+
+    struct DeriveRequest
+    {
+        const Pbkdf2 * Key_;
+        const uint8_t * Salt_;
+        size_t SaltSize_;
+        uint32_t Iterations_;
+        uint8_t * Out_;
+        size_t OutSize_;
+    };
+
+    template<typename InputIt>
+    Pbkdf2(InputIt passwordBegin, InputIt passwordEnd)
+        : Mac_(passwordBegin, passwordEnd)
+    { }
+
+    void Derive(uint8_t * out, size_t outSize, const uint8_t * salt, size_t saltSize, uint32_t iterations) const
+    {
+        const DeriveRequest request = { this, salt, saltSize, iterations, out, outSize };
+        DeriveBatch(&request, 1);
+    }
+
+    // Output blocks of all requests are run LANE_COUNT at a time, so the
+    // blocks of one long key and the keys of different passwords share the
+    // iteration loop alike. Every request is checked before any output is
+    // written.
+    static void DeriveBatch(const DeriveRequest * requests, size_t count)
+    {
+        for (size_t r = 0; r < count; ++r)
+        {
+            if (requests[r].Iterations_ == 0)
+            {
+                throw Service::ChaosException("Pbkdf2: iteration count must be positive");
+            }
+        }
+
+        std::array<Lane, LANE_COUNT> lanes;
+        size_t laneCount = 0;
+
+        for (size_t r = 0; r < count; ++r)
+        {
+            const DeriveRequest & request = requests[r];
+            const size_t blockCount = (request.OutSize_ + DIGEST_SIZE_BYTES - 1) / DIGEST_SIZE_BYTES;
+
+            for (size_t block = 0; block < blockCount; ++block)
+            {
+                Lane & lane = lanes[laneCount++];
+
+                lane.Request_ = &request;
+                lane.Offset_ = block * DIGEST_SIZE_BYTES;
+                lane.Size_ = std::min(DIGEST_SIZE_BYTES, request.OutSize_ - lane.Offset_);
+                lane.Index_ = static_cast<uint32_t>(block + 1);
+
+                if (laneCount == lanes.size())
+                {
+                    RunLanes(lanes.data(), laneCount);
+                    laneCount = 0;
+                }
+            }
+        }
+
+        RunLanes(lanes.data(), laneCount);
+    }
+
+private:
+    using Buffer = typename Engine::Buffer;
+    using Block = typename Engine::Block;
+    using Word = typename Engine::Word;
+
+    static constexpr size_t DIGEST_SIZE_WORDS = DIGEST_SIZE_BYTES / sizeof(Word);
+    static constexpr size_t BLOCK_SIZE_BYTES = Engine::BLOCK_SIZE_BYTES;
+
+    static_assert(DIGEST_SIZE_BYTES % sizeof(Word) == 0);
+    static_assert(DIGEST_SIZE_BYTES + 1 + Engine::LENGTH_SIZE_BYTES <= BLOCK_SIZE_BYTES);
+
+    struct Lane
+    {
+        const DeriveRequest * Request_;
+        size_t Offset_;
+        size_t Size_;
+        uint32_t Index_;
+
+        const Buffer * InnerState_;
+        const Buffer * OuterState_;
+
+        Block Block_;
+        std::array<Word, DIGEST_SIZE_WORDS> Sum_;
+    };
+
+    Mac::Hmac::Hmac<HasherImpl> Mac_;
+
+    // U_1 goes through the regular HMAC; every further U_i is one
+    // compression from each cached midstate over the fixed padding block.
+    static void RunLanes(Lane * lanes, size_t laneCount)
+    {
+        static const Block PADDING_BLOCK = Engine::MakeFinalBlock(BLOCK_SIZE_BYTES, DIGEST_SIZE_BYTES);
+
+        uint32_t maxIterations = 0;
+
+        for (size_t l = 0; l < laneCount; ++l)
+        {
+            Lane & lane = lanes[l];
+            const DeriveRequest & request = *lane.Request_;
+
+            const uint8_t index[] =
+            {
+                static_cast<uint8_t>(lane.Index_ >> 24),
+                static_cast<uint8_t>(lane.Index_ >> 16),
+                static_cast<uint8_t>(lane.Index_ >> 8),
+                static_cast<uint8_t>(lane.Index_)
+            };
+
+            Mac::Hmac::Hmac<HasherImpl> mac = request.Key_->Mac_;
+            mac.Update(request.Salt_, request.Salt_ + request.SaltSize_);
+            mac.Update(index, index + sizeof(index));
+
+            auto digest = mac.Finish().GetRawDigest();
+
+            lane.InnerState_ = &request.Key_->Mac_.GetInnerHasher().GetEngine().GetBuffer();
+            lane.OuterState_ = &request.Key_->Mac_.GetOuterHasher().GetEngine().GetBuffer();
+            lane.Block_ = PADDING_BLOCK;
+
+            for (size_t w = 0; w < DIGEST_SIZE_WORDS; ++w)
+            {
+                lane.Block_[w] = Engine::LoadWord(digest.data() + w * sizeof(Word));
+                lane.Sum_[w] = lane.Block_[w];
+            }
+
+            Service::SecureErase(digest.data(), digest.size());
+
+            maxIterations = std::max(maxIterations, request.Iterations_);
+        }
+
+        for (uint32_t i = 1; i < maxIterations; ++i)
+        {
+            for (size_t l = 0; l < laneCount; ++l)
+            {
+                Lane & lane = lanes[l];
+
+                if (i >= lane.Request_->Iterations_)
+                {
+                    continue;
+                }
+
+                Buffer inner = *lane.InnerState_;
+                Engine::Compress(inner, lane.Block_);
+                std::copy(std::begin(inner.Regs_), std::end(inner.Regs_), lane.Block_.begin());
+
+                Buffer outer = *lane.OuterState_;
+                Engine::Compress(outer, lane.Block_);
+                std::copy(std::begin(outer.Regs_), std::end(outer.Regs_), lane.Block_.begin());
+
+                for (size_t w = 0; w < DIGEST_SIZE_WORDS; ++w)
+                {
+                    lane.Sum_[w] ^= outer.Regs_[w];
+                }
+            }
+        }
+
+        for (size_t l = 0; l < laneCount; ++l)
+        {
+            Lane & lane = lanes[l];
+
+            std::array<uint8_t, DIGEST_SIZE_BYTES> bytes;
+
+            for (size_t w = 0; w < DIGEST_SIZE_WORDS; ++w)
+            {
+                Engine::StoreWord(bytes.data() + w * sizeof(Word), lane.Sum_[w]);
+            }
+
+            std::copy_n(bytes.begin(), lane.Size_, lane.Request_->Out_ + lane.Offset_);
+
+            Service::SecureErase(bytes.data(), bytes.size());
+            Service::SecureErase(lane.Block_.data(), sizeof(lane.Block_));
+            Service::SecureErase(lane.Sum_.data(), sizeof(lane.Sum_));
+        }
+    }
+};
+
+} // namespace Chaos::Kdf::Pbkdf2
+
+#endif // CHAOS_KDF_PBKDF2_HPP
@@ -0,0 +1,179 @@
+#ifndef CHAOS_KDF_TLSPRF_HPP
+#define CHAOS_KDF_TLSPRF_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "Hash/Md5.hpp"
+#include "Hash/Segment.hpp"
+#include "Hash/Sha1.hpp"
+#include "Mac/Hmac.hpp"
+#include "Service/SecureAllocator.hpp"
+#include "Service/SecureErase.hpp"
+
+namespace Chaos::Kdf::TlsPrf::Inner_
+{
+
+// P_hash (RFC 2246 5): out receives size bytes of HMAC(secret, A(i) + seed),
+// either copied or XORed in. The keyed midstate is copied once and reused for
+// every A(i) and output block.
+template<bool XOR, typename HasherImpl>
+void ExpandHash(const Mac::Hmac::Hmac<HasherImpl> & key, uint8_t * out, size_t size,
+                std::initializer_list<Hash::Segment> seed)
+{
+    Mac::Hmac::Hmac<HasherImpl> mac = key;
+
+    mac.Update(seed);
+    auto a = mac.Finish().GetRawDigest();
+
+    for (size_t offset = 0; offset < size; offset += a.size())
+    {
+        mac.Update(a.begin(), a.end());
+        mac.Update(seed);
+
+        auto block = mac.Finish().GetRawDigest();
+        const size_t blockSize = std::min(block.size(), size - offset);
+
+        for (size_t i = 0; i < blockSize; ++i)
+        {
+            if constexpr (XOR)
+            {
+                out[offset + i] ^= block[i];
+            }
+            else
+            {
+                out[offset + i] = block[i];
+            }
+        }
+
+        Service::SecureErase(block.data(), block.size());
+
+        if (offset + a.size() < size)
+        {
+            mac.Update(a.begin(), a.end());
+            a = mac.Finish().GetRawDigest();
+        }
+    }
+
+    Service::SecureErase(a.data(), a.size());
+}
+
+} // namespace Chaos::Kdf::TlsPrf::Inner_
+
+namespace Chaos::Kdf::TlsPrf
+{
+
+inline constexpr size_t RANDOM_SIZE_BYTES = 32;
+inline constexpr size_t MASTER_SECRET_SIZE_BYTES = 48;
+inline constexpr size_t HANDSHAKE_HASHES_SIZE_BYTES = 36;
+inline constexpr size_t VERIFY_DATA_SIZE_BYTES = 12;
+
+inline constexpr char MASTER_SECRET_LABEL[] = "master secret";
+inline constexpr char KEY_EXPANSION_LABEL[] = "key expansion";
+inline constexpr char CLIENT_FINISHED_LABEL[] = "client finished";
+inline constexpr char SERVER_FINISHED_LABEL[] = "server finished";
+
+using MasterSecret = std::array<uint8_t, MASTER_SECRET_SIZE_BYTES>;
+using VerifyData = std::array<uint8_t, VERIFY_DATA_SIZE_BYTES>;
+
+// The TLS 1.0/1.1 PRF (RFC 2246 5, RFC 4346 5) keyed with one secret:
+// P_MD5 over its first half XOR P_SHA-1 over its second half. Both HMAC
+// midstates are built once, so a session's master secret, key block and
+// Finished messages never rehash the secret.
+class TlsPrf
+{
+public:
+    // The HMACs are keyed straight from a multi-pass range; a single-pass
+    // one is first copied into pool memory.
+    template<typename InputIt>
+    TlsPrf(InputIt secretBegin, InputIt secretEnd)
+    {
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>)
+        {
+            Rekey(secretBegin, secretEnd);
+        }
+        else
+        {
+            const std::vector<uint8_t, Service::SecureAllocator<uint8_t>> secret(secretBegin, secretEnd);
+            Rekey(secret.begin(), secret.end());
+        }
+    }
+
+    // out receives size bytes of PRF(secret, label, seed), where the label
+    // and seed are given as the segments they are concatenated from.
+    void Generate(uint8_t * out, size_t size, std::initializer_list<Hash::Segment> labelAndSeed) const
+    {
+        Inner_::ExpandHash<false>(Md5Mac_, out, size, labelAndSeed);
+        Inner_::ExpandHash<true>(Sha1Mac_, out, size, labelAndSeed);
+    }
+
+    // Keyed with the pre-master secret.
+    MasterSecret ComputeMasterSecret(const uint8_t * clientRandom, const uint8_t * serverRandom) const
+    {
+        MasterSecret result;
+
+        Generate(result.data(), result.size(),
+                 {
+                     { MASTER_SECRET_LABEL, sizeof(MASTER_SECRET_LABEL) - 1 },
+                     { clientRandom, RANDOM_SIZE_BYTES },
+                     { serverRandom, RANDOM_SIZE_BYTES }
+                 });
+
+        return result;
+    }
+
+    // Keyed with the master secret.
+    void ComputeKeyBlock(uint8_t * out, size_t size, const uint8_t * serverRandom,
+                         const uint8_t * clientRandom) const
+    {
+        Generate(out, size,
+                 {
+                     { KEY_EXPANSION_LABEL, sizeof(KEY_EXPANSION_LABEL) - 1 },
+                     { serverRandom, RANDOM_SIZE_BYTES },
+                     { clientRandom, RANDOM_SIZE_BYTES }
+                 });
+    }
+
+    // Keyed with the master secret; handshakeHashes is MD5 followed by
+    // SHA-1 of the handshake messages.
+    VerifyData ComputeVerifyData(const char * label, const uint8_t * handshakeHashes) const
+    {
+        VerifyData result;
+
+        Generate(result.data(), result.size(),
+                 {
+                     { label, std::strlen(label) },
+                     { handshakeHashes, HANDSHAKE_HASHES_SIZE_BYTES }
+                 });
+
+        return result;
+    }
+
+private:
+    Mac::Hmac::Hmac<Hash::Md5::Md5Hasher> Md5Mac_;
+    Mac::Hmac::Hmac<Hash::Sha1::Sha1Hasher> Sha1Mac_;
+
+    // The halves overlap by one byte when the secret size is odd.
+    template<typename ForwardIt>
+    void Rekey(ForwardIt secretBegin, ForwardIt secretEnd)
+    {
+        const size_t secretSize = static_cast<size_t>(std::distance(secretBegin, secretEnd));
+        const size_t halfSize = (secretSize + 1) / 2;
+
+        Md5Mac_.Rekey(secretBegin, std::next(secretBegin, halfSize));
+        Sha1Mac_.Rekey(std::next(secretBegin, secretSize - halfSize), secretEnd);
+    }
+};
+
+} // namespace Chaos::Kdf::TlsPrf
+
+#endif // CHAOS_KDF_TLSPRF_HPP
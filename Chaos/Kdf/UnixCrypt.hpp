@@ -0,0 +1,598 @@
+#ifndef CHAOS_KDF_UNIXCRYPT_HPP
+#define CHAOS_KDF_UNIXCRYPT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "Cipher/Block/Des/DesCrypt.hpp"
+#include "Service/ChaosException.hpp"
+#include "Service/ConstantTime.hpp"
+#include "Service/SeArray.hpp"
+#include "Service/SecureErase.hpp"
+
+namespace Chaos::Kdf::UnixCrypt
+{
+
+inline constexpr size_t SALT_SIZE = 2;
+inline constexpr size_t HASH_SIZE = 13;
+inline constexpr size_t MAX_PASSWORD_SIZE = 8;
+inline constexpr int_fast8_t ITERATION_COUNT = 25;
+
+} // namespace Chaos::Kdf::UnixCrypt
+
+namespace Chaos::Kdf::UnixCrypt::Inner_
+{
+
+inline constexpr char ALPHABET[] = "./0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+inline int_fast8_t DecodeChar(char c)
+{
+    if (c >= '.' && c <= '9')
+    {
+        return static_cast<int_fast8_t>(c - '.');
+    }
+
+    if (c >= 'A' && c <= 'Z')
+    {
+        return static_cast<int_fast8_t>(c - 'A' + 12);
+    }
+
+    if (c >= 'a' && c <= 'z')
+    {
+        return static_cast<int_fast8_t>(c - 'a' + 38);
+    }
+
+    return -1;
+}
+
+// The final permutation IP^-1. The 25 encryptions are chained without the
+// IP/FP pair between them, so it is applied once, to the last block.
+inline constexpr int_fast8_t FP_TABLE[64] =
+{
+    40,  8, 48, 16, 56, 24, 64, 32,
+    39,  7, 47, 15, 55, 23, 63, 31,
+    38,  6, 46, 14, 54, 22, 62, 30,
+    37,  5, 45, 13, 53, 21, 61, 29,
+    36,  4, 44, 12, 52, 20, 60, 28,
+    35,  3, 43, 11, 51, 19, 59, 27,
+    34,  2, 42, 10, 50, 18, 58, 26,
+    33,  1, 41,  9, 49, 17, 57, 25
+};
+
+inline constexpr Cipher::Block::Des::Inner_::ChoiceTables<64> FP_TABLES =
+    Cipher::Block::Des::Inner_::MakeChoiceTables<64, 64>(FP_TABLE);
+
+using RoundKeys = Service::SeArray<uint64_t, 16>;
+
+// Salt bit 6 * i + j swaps bits 6 * i + j and 6 * i + j + 24 of the E
+// expansion, i.e. bit j of the inputs of S-boxes i + 1 and i + 5. The swaps
+// are kept as two 6-bit masks over those S-box inputs.
+struct SaltedExpansion
+{
+    uint32_t Swap15_;
+    uint32_t Swap26_;
+};
+
+inline SaltedExpansion MakeSaltedExpansion(uint32_t salt)
+{
+    SaltedExpansion result = { 0, 0 };
+
+    for (int_fast8_t j = 0; j < 6; ++j)
+    {
+        result.Swap15_ |= ((salt >> j) & 0b1) << (5 - j);
+        result.Swap26_ |= ((salt >> (6 + j)) & 0b1) << (5 - j);
+    }
+
+    return result;
+}
+
+template<typename InputIt>
+void LoadRoundKeys(RoundKeys & roundKeys, InputIt passwordBegin, InputIt passwordEnd)
+{
+    Cipher::Block::Des::Inner_::RawKey rawKey;
+
+    size_t i = 0;
+    for (InputIt it = passwordBegin; i < MAX_PASSWORD_SIZE && it != passwordEnd; ++i, ++it)
+    {
+        rawKey[i] = static_cast<uint8_t>(static_cast<uint8_t>(*it) << 1);
+    }
+
+    const Cipher::Block::Des::Inner_::KeySchedule schedule(
+        Cipher::Block::Des::Inner_::KeySchedule::Direction::Encrypt, rawKey);
+
+    for (int_fast8_t r = 0; r < 16; ++r)
+    {
+        roundKeys[r] = schedule[r];
+    }
+}
+
+inline uint32_t Rotl(uint32_t value, int_fast8_t shift)
+{
+    return (value << shift) | (value >> (32 - shift));
+}
+
+// DES's F with the salt swaps applied to the expanded S-box inputs before
+// the round key is mixed in.
+inline uint32_t F(uint32_t value, uint64_t roundKey, const SaltedExpansion & salt)
+{
+    const auto & sp = Cipher::Block::Des::Inner_::SP_TABLES.Table_;
+
+    uint32_t e1 = Rotl(value,  5);
+    uint32_t e2 = Rotl(value,  9);
+    uint32_t e5 = Rotl(value, 21);
+    uint32_t e6 = Rotl(value, 25);
+
+    const uint32_t t15 = (e1 ^ e5) & salt.Swap15_;
+    const uint32_t t26 = (e2 ^ e6) & salt.Swap26_;
+
+    e1 ^= t15;
+    e5 ^= t15;
+    e2 ^= t26;
+    e6 ^= t26;
+
+    return sp[0][(e1 ^ (roundKey >> 42)) & 0x3f] ^
+           sp[1][(e2 ^ (roundKey >> 36)) & 0x3f] ^
+           sp[2][(Rotl(value, 13) ^ (roundKey >> 30)) & 0x3f] ^
+           sp[3][(Rotl(value, 17) ^ (roundKey >> 24)) & 0x3f] ^
+           sp[4][(e5 ^ (roundKey >> 18)) & 0x3f] ^
+           sp[5][(e6 ^ (roundKey >> 12)) & 0x3f] ^
+           sp[6][(Rotl(value, 29) ^ (roundKey >>  6)) & 0x3f] ^
+           sp[7][(Rotl(value,  1) ^ (roundKey >>  0)) & 0x3f];
+}
+
+// Encrypts the zero block 25 times with one key and salt.
+inline uint64_t EncryptZeroBlock(const RoundKeys & keys, const SaltedExpansion & salt)
+{
+    uint32_t l = 0;
+    uint32_t r = 0;
+
+    for (int_fast8_t iteration = 0; iteration < ITERATION_COUNT; ++iteration)
+    {
+        for (int_fast8_t round = 0; round < 16; round += 2)
+        {
+            l ^= F(r, keys[round], salt);
+            r ^= F(l, keys[round + 1], salt);
+        }
+
+        std::swap(l, r);
+    }
+
+    return FP_TABLES((static_cast<uint64_t>(l) << 32) | r);
+}
+
+// Bitsliced DES: slice i holds bit i of the same quantity for 64 lanes, so
+// one bitwise operation does the work of 64 table-driven encryptions. Bits
+// are numbered from the most significant one, as in the DES tables.
+using Slice = uint64_t;
+
+inline constexpr size_t BITSLICE_LANE_COUNT = 64;
+
+inline constexpr int_fast8_t E_TABLE[48] =
+{
+    32,  1,  2,  3,  4,  5,
+     4,  5,  6,  7,  8,  9,
+     8,  9, 10, 11, 12, 13,
+    12, 13, 14, 15, 16, 17,
+    16, 17, 18, 19, 20, 21,
+    20, 21, 22, 23, 24, 25,
+    24, 25, 26, 27, 28, 29,
+    28, 29, 30, 31, 32,  1
+};
+
+// Index_[round][bit] is the raw key bit that lands in bit of the round key;
+// the key schedule is a fixed wiring, so no per-key work is left.
+struct KeyBitTables
+{
+    uint8_t Index_[16][48];
+};
+
+constexpr KeyBitTables MakeKeyBitTables()
+{
+    KeyBitTables result = {};
+    int_fast8_t shift = 0;
+
+    for (int_fast8_t round = 0; round < 16; ++round)
+    {
+        shift += (round == 0 || round == 1 || round == 8 || round == 15) ? 1 : 2;
+
+        for (int_fast8_t bit = 0; bit < 48; ++bit)
+        {
+            const int_fast8_t cd = Cipher::Block::Des::Inner_::PC2_TABLE[bit] - 1;
+            const int_fast8_t rotated = (cd / 28) * 28 + (cd % 28 + shift) % 28;
+
+            result.Index_[round][bit] = static_cast<uint8_t>(Cipher::Block::Des::Inner_::PC1_TABLE[rotated] - 1);
+        }
+    }
+
+    return result;
+}
+
+inline constexpr KeyBitTables KEY_BIT_TABLES = MakeKeyBitTables();
+
+// Index_[i] is the bit of F's output that S-box output bit i moves to.
+struct PInverseTable
+{
+    uint8_t Index_[32];
+};
+
+constexpr PInverseTable MakePInverseTable()
+{
+    PInverseTable result = {};
+
+    for (int_fast8_t bit = 0; bit < 32; ++bit)
+    {
+        result.Index_[Cipher::Block::Des::Inner_::P_TABLE[bit] - 1] = static_cast<uint8_t>(bit);
+    }
+
+    return result;
+}
+
+inline constexpr PInverseTable P_INVERSE_TABLE = MakePInverseTable();
+
+// The S-boxes are evaluated as Boolean functions of their six input slices:
+// the minterms of the upper and lower three bits select, for each output
+// bit, which of the eight 3-bit columns is taken. Every choice is made from
+// the constant S-box tables at compile time, so only ANDs and ORs of the
+// needed slices remain.
+template<size_t Box, size_t Bit>
+constexpr bool SBoxBit(size_t input)
+{
+    return (Cipher::Block::Des::Inner_::SBOX_TABLES[Box][input] >> (3 - Bit)) & 0b1;
+}
+
+template<size_t Box, size_t Bit, size_t Hi>
+constexpr size_t ColumnWeight()
+{
+    size_t result = 0;
+
+    for (size_t lo = 0; lo < 8; ++lo)
+    {
+        result += SBoxBit<Box, Bit>(Hi * 8 + lo) ? 1 : 0;
+    }
+
+    return result;
+}
+
+template<bool IsTaken>
+inline Slice Take(Slice slice)
+{
+    if constexpr (IsTaken)
+    {
+        return slice;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+// OR of the lower minterms for which the output bit is set, or the
+// complement of the others when that is shorter.
+template<size_t Box, size_t Bit, size_t Hi, size_t... Lo>
+inline Slice Column(const Slice * lo, std::index_sequence<Lo...>)
+{
+    if constexpr (ColumnWeight<Box, Bit, Hi>() <= 4)
+    {
+        return (Slice(0) | ... | Take<SBoxBit<Box, Bit>(Hi * 8 + Lo)>(lo[Lo]));
+    }
+    else
+    {
+        return ~(Slice(0) | ... | Take<!SBoxBit<Box, Bit>(Hi * 8 + Lo)>(lo[Lo]));
+    }
+}
+
+template<size_t Box, size_t Bit, size_t... Hi>
+inline Slice SBoxOutput(const Slice * hi, const Slice * lo, std::index_sequence<Hi...>)
+{
+    return (Slice(0) | ... | (hi[Hi] & Column<Box, Bit, Hi>(lo, std::make_index_sequence<8>())));
+}
+
+inline void Minterms(Slice a, Slice b, Slice c, Slice * minterms)
+{
+    const Slice notA = ~a;
+    const Slice notB = ~b;
+    const Slice notC = ~c;
+
+    const Slice ab[4] = { notA & notB, notA & b, a & notB, a & b };
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        minterms[2 * i] = ab[i] & notC;
+        minterms[2 * i + 1] = ab[i] & c;
+    }
+}
+
+template<size_t Box, size_t... Bit>
+inline void SBox(const Slice * input, Slice * out, std::index_sequence<Bit...>)
+{
+    Slice hi[8];
+    Slice lo[8];
+
+    Minterms(input[0], input[1], input[2], hi);
+    Minterms(input[3], input[4], input[5], lo);
+
+    ((out[P_INVERSE_TABLE.Index_[4 * Box + Bit]] ^= SBoxOutput<Box, Bit>(hi, lo, std::make_index_sequence<8>())), ...);
+}
+
+template<size_t... Box>
+inline void SBoxes(const Slice * expanded, Slice * out, std::index_sequence<Box...>)
+{
+    (SBox<Box>(expanded + 6 * Box, out, std::make_index_sequence<4>()), ...);
+}
+
+// out ^= F(in). Salt bit j swaps slices j and j + 24 of the expansion in
+// the lanes whose bit is set in salt[j].
+inline void BitslicedF(Slice * out, const Slice * in, const Slice * key, const uint8_t * keyIndex, const Slice * salt)
+{
+    Slice expanded[48];
+
+    for (size_t j = 0; j < 48; ++j)
+    {
+        expanded[j] = in[E_TABLE[j] - 1];
+    }
+
+    for (size_t j = 0; j < 12; ++j)
+    {
+        const Slice t = (expanded[j] ^ expanded[j + 24]) & salt[j];
+
+        expanded[j] ^= t;
+        expanded[j + 24] ^= t;
+    }
+
+    for (size_t j = 0; j < 48; ++j)
+    {
+        expanded[j] ^= key[keyIndex[j]];
+    }
+
+    SBoxes(expanded, out, std::make_index_sequence<8>());
+
+    Service::SecureErase(expanded, sizeof(expanded));
+}
+
+// Lanes of a bitsliced run: 64 raw key slices and 12 salt slices.
+struct BitslicedLanes
+{
+    Service::SeArray<Slice, 64> Key_;
+    std::array<Slice, 12> Salt_ = {};
+};
+
+template<typename InputIt>
+void LoadBitslicedLane(BitslicedLanes & lanes, size_t lane, InputIt passwordBegin, InputIt passwordEnd, uint32_t salt)
+{
+    size_t i = 0;
+    for (InputIt it = passwordBegin; i < MAX_PASSWORD_SIZE && it != passwordEnd; ++i, ++it)
+    {
+        const uint8_t byte = static_cast<uint8_t>(static_cast<uint8_t>(*it) << 1);
+
+        for (size_t bit = 0; bit < 8; ++bit)
+        {
+            lanes.Key_[8 * i + bit] |= static_cast<Slice>((byte >> (7 - bit)) & 0b1) << lane;
+        }
+    }
+
+    for (size_t j = 0; j < lanes.Salt_.size(); ++j)
+    {
+        lanes.Salt_[j] |= static_cast<Slice>((salt >> j) & 0b1) << lane;
+    }
+}
+
+// Encrypts the zero block 25 times in all 64 lanes; results[lane] gets the
+// same value EncryptZeroBlock would.
+inline void EncryptZeroBlockBitsliced(const BitslicedLanes & lanes, uint64_t * results)
+{
+    Service::SeArray<Slice, 64> halves;
+
+    Slice * l = halves.Begin();
+    Slice * r = halves.Begin() + 32;
+
+    for (int_fast8_t iteration = 0; iteration < ITERATION_COUNT; ++iteration)
+    {
+        for (int_fast8_t round = 0; round < 16; round += 2)
+        {
+            BitslicedF(l, r, lanes.Key_.Begin(), KEY_BIT_TABLES.Index_[round], lanes.Salt_.data());
+            BitslicedF(r, l, lanes.Key_.Begin(), KEY_BIT_TABLES.Index_[round + 1], lanes.Salt_.data());
+        }
+
+        std::swap(l, r);
+    }
+
+    for (size_t lane = 0; lane < BITSLICE_LANE_COUNT; ++lane)
+    {
+        uint64_t block = 0;
+
+        for (size_t bit = 0; bit < 32; ++bit)
+        {
+            block |= ((l[bit] >> lane) & 0b1) << (63 - bit);
+            block |= ((r[bit] >> lane) & 0b1) << (31 - bit);
+        }
+
+        results[lane] = FP_TABLES(block);
+    }
+}
+
+} // namespace Chaos::Kdf::UnixCrypt::Inner_
+
+namespace Chaos::Kdf::UnixCrypt
+{
+
+// A traditional DES-based crypt(3) hash: a 12-bit salt and the 64-bit
+// result of 25 salted DES encryptions of zero under the first 8 password
+// characters, written as 13 characters of "./0-9A-Za-z".
+class PasswordHash
+{
+public:
+    // A 64-lane bitsliced pass costs about as much as 48 scalar hashes, so
+    // smaller groups are hashed one by one.
+    static constexpr size_t MIN_BITSLICED_BATCH_SIZE = 48;
+
+    struct VerifyRequest
+    {
+        const PasswordHash * Hash_;
+        const char * Password_;
+        size_t PasswordSize_;
+    };
+
+    explicit PasswordHash(const std::string & encoded)
+        : Salt_(DecodeSalt(encoded)),
+          Value_(0)
+    {
+        if (encoded.size() != HASH_SIZE)
+        {
+            throw Service::ChaosException("UnixCrypt::PasswordHash: invalid hash length (13 characters required)");
+        }
+
+        for (size_t i = SALT_SIZE; i < HASH_SIZE; ++i)
+        {
+            const int_fast8_t digit = Inner_::DecodeChar(encoded[i]);
+
+            if (digit < 0)
+            {
+                throw Service::ChaosException("UnixCrypt::PasswordHash: invalid hash character");
+            }
+
+            if (i + 1 < HASH_SIZE)
+            {
+                Value_ = (Value_ << 6) | static_cast<uint64_t>(digit);
+            }
+            else if ((digit & 0b11) == 0)
+            {
+                Value_ = (Value_ << 4) | static_cast<uint64_t>(digit >> 2);
+            }
+            else
+            {
+                throw Service::ChaosException("UnixCrypt::PasswordHash: non-canonical hash");
+            }
+        }
+    }
+
+    template<typename InputIt>
+    static PasswordHash Compute(InputIt passwordBegin, InputIt passwordEnd, const std::string & salt)
+    {
+        const uint32_t saltBits = DecodeSalt(salt);
+
+        return PasswordHash(saltBits, ComputeValue(saltBits, passwordBegin, passwordEnd));
+    }
+
+    template<typename InputIt>
+    bool Verify(InputIt passwordBegin, InputIt passwordEnd) const
+    {
+        const uint64_t value = ComputeValue(Salt_, passwordBegin, passwordEnd);
+
+        return Service::ConstantTimeEqual(&value, &Value_, sizeof(Value_));
+    }
+
+    // Verifies many login attempts, each against its own stored hash and
+    // salt, 64 at a time through bitsliced DES.
+    static void VerifyBatch(const VerifyRequest * requests, size_t count, bool * results)
+    {
+        std::array<uint64_t, Inner_::BITSLICE_LANE_COUNT> values;
+
+        for (size_t groupBegin = 0; groupBegin < count; groupBegin += Inner_::BITSLICE_LANE_COUNT)
+        {
+            const size_t groupSize = std::min(Inner_::BITSLICE_LANE_COUNT, count - groupBegin);
+
+            if (groupSize < MIN_BITSLICED_BATCH_SIZE)
+            {
+                for (size_t l = 0; l < groupSize; ++l)
+                {
+                    const VerifyRequest & request = requests[groupBegin + l];
+
+                    values[l] = ComputeValue(request.Hash_->Salt_, request.Password_,
+                                             request.Password_ + request.PasswordSize_);
+                }
+            }
+            else
+            {
+                Inner_::BitslicedLanes lanes;
+
+                for (size_t l = 0; l < groupSize; ++l)
+                {
+                    const VerifyRequest & request = requests[groupBegin + l];
+
+                    Inner_::LoadBitslicedLane(lanes, l, request.Password_, request.Password_ + request.PasswordSize_,
+                                              request.Hash_->Salt_);
+                }
+
+                Inner_::EncryptZeroBlockBitsliced(lanes, values.data());
+            }
+
+            for (size_t l = 0; l < groupSize; ++l)
+            {
+                const PasswordHash & hash = *requests[groupBegin + l].Hash_;
+
+                results[groupBegin + l] = Service::ConstantTimeEqual(&values[l], &hash.Value_, sizeof(hash.Value_));
+            }
+        }
+
+        Service::SecureErase(values.data(), sizeof(values));
+    }
+
+    std::string GetSalt() const
+    {
+        return { Inner_::ALPHABET[Salt_ & 0x3f], Inner_::ALPHABET[Salt_ >> 6] };
+    }
+
+    std::string ToString() const
+    {
+        std::string result = GetSalt();
+
+        for (int_fast8_t shift = 58; shift >= 4; shift -= 6)
+        {
+            result += Inner_::ALPHABET[(Value_ >> shift) & 0x3f];
+        }
+
+        result += Inner_::ALPHABET[(Value_ & 0b1111) << 2];
+
+        return result;
+    }
+
+private:
+    uint32_t Salt_;
+    uint64_t Value_;
+
+    PasswordHash(uint32_t salt, uint64_t value)
+        : Salt_(salt),
+          Value_(value)
+    { }
+
+    template<typename InputIt>
+    static uint64_t ComputeValue(uint32_t salt, InputIt passwordBegin, InputIt passwordEnd)
+    {
+        Inner_::RoundKeys keys;
+        Inner_::LoadRoundKeys(keys, passwordBegin, passwordEnd);
+
+        return Inner_::EncryptZeroBlock(keys, Inner_::MakeSaltedExpansion(salt));
+    }
+
+    static uint32_t DecodeSalt(const std::string & encoded)
+    {
+        if (encoded.size() < SALT_SIZE)
+        {
+            throw Service::ChaosException("UnixCrypt: invalid salt length (2 characters required)");
+        }
+
+        const int_fast8_t low = Inner_::DecodeChar(encoded[0]);
+        const int_fast8_t high = Inner_::DecodeChar(encoded[1]);
+
+        if (low < 0 || high < 0)
+        {
+            throw Service::ChaosException("UnixCrypt: invalid salt character");
+        }
+
+        return static_cast<uint32_t>(low) | (static_cast<uint32_t>(high) << 6);
+    }
+};
+
+template<typename InputIt>
+std::string Crypt(InputIt passwordBegin, InputIt passwordEnd, const std::string & salt)
+{
+    return PasswordHash::Compute(passwordBegin, passwordEnd, salt).ToString();
+}
+
+} // namespace Chaos::Kdf::UnixCrypt
+
+#endif // CHAOS_KDF_UNIXCRYPT_HPP
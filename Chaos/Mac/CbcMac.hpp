@@ -0,0 +1,371 @@
+#ifndef CHAOS_MAC_CBCMAC_HPP
+#define CHAOS_MAC_CBCMAC_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+
+#include "Cipher/Block/Block64.hpp"
+#include "Cipher/Block/Des/DesCrypt.hpp"
+#include "Cipher/Block/Encryptor.hpp"
+#include "Service/ByteIterator.hpp"
+#include "Service/ChaosException.hpp"
+#include "Service/ConstantTime.hpp"
+#include "Service/SecureErase.hpp"
+
+namespace Chaos::Mac::CbcMac
+{
+
+using Tag = std::array<uint8_t, 8>;
+
+inline constexpr size_t BLOCK_SIZE_BYTES = 8;
+
+// ISO/IEC 9797-1 padding methods 1 (zero bits, at least one block) and
+// 2 (a single one bit, then zero bits).
+enum class Padding
+{
+    Method1,
+    Method2
+};
+
+} // namespace Chaos::Mac::CbcMac
+
+namespace Chaos::Mac::CbcMac::Inner_
+{
+
+// The padded last block of a message of messageSize bytes whose last
+// tailSize bytes (less than a block) are not chained yet; nullopt when
+// method 1 has nothing left to add.
+inline std::optional<uint64_t> PadLastBlock(Padding padding, const uint8_t * tail, size_t tailSize,
+                                            uint64_t messageSize)
+{
+    if (padding == Padding::Method1 && tailSize == 0 && messageSize > 0)
+    {
+        return std::nullopt;
+    }
+
+    std::array<uint8_t, BLOCK_SIZE_BYTES> bytes = {};
+    std::copy_n(tail, tailSize, bytes.begin());
+
+    if (padding == Padding::Method2)
+    {
+        bytes[tailSize] = 0x80;
+    }
+
+    const uint64_t result = Cipher::Block::Inner_::LoadBlock64(bytes.data());
+    Service::SecureErase(bytes.data(), bytes.size());
+
+    return result;
+}
+
+// CBC chaining over a 64-bit block cipher with a zero IV. Full blocks of
+// contiguous input are chained straight from the caller's buffer.
+class Chain
+{
+public:
+    explicit Chain(Padding padding)
+        : Padding_(padding),
+          State_(0),
+          PendingSize_(0),
+          MessageSize_(0)
+    { }
+
+    void Reset()
+    {
+        State_ = 0;
+        PendingSize_ = 0;
+        MessageSize_ = 0;
+    }
+
+    template<typename EncryptorImpl>
+    void Update(const EncryptorImpl & encryptor, const uint8_t * data, size_t size)
+    {
+        MessageSize_ += size;
+
+        if (PendingSize_ > 0)
+        {
+            const size_t taken = std::min(size, BLOCK_SIZE_BYTES - PendingSize_);
+
+            std::copy(data, data + taken, Pending_.begin() + PendingSize_);
+            PendingSize_ += taken;
+            data += taken;
+            size -= taken;
+
+            if (PendingSize_ < BLOCK_SIZE_BYTES)
+            {
+                return;
+            }
+
+            State_ = encryptor.EncryptBlock(State_ ^ Cipher::Block::Inner_::LoadBlock64(Pending_.data()));
+            PendingSize_ = 0;
+        }
+
+        for (; size >= BLOCK_SIZE_BYTES; size -= BLOCK_SIZE_BYTES, data += BLOCK_SIZE_BYTES)
+        {
+            State_ = encryptor.EncryptBlock(State_ ^ Cipher::Block::Inner_::LoadBlock64(data));
+        }
+
+        std::copy(data, data + size, Pending_.begin());
+        PendingSize_ = size;
+    }
+
+    template<typename EncryptorImpl, typename InputIt>
+    void Update(const EncryptorImpl & encryptor, InputIt begin, InputIt end)
+    {
+        if constexpr (Service::IsContiguousByteIterator<InputIt>)
+        {
+            if (begin != end)
+            {
+                Update(encryptor, Service::ToBytePointer(begin), static_cast<size_t>(end - begin));
+            }
+        }
+        else
+        {
+            for (InputIt it = begin; it != end; ++it)
+            {
+                const uint8_t byte = static_cast<uint8_t>(*it);
+                Update(encryptor, &byte, 1);
+            }
+        }
+    }
+
+    // Pads, chains the last block and returns the final chaining value;
+    // the chain is reset afterwards.
+    template<typename EncryptorImpl>
+    uint64_t Finish(const EncryptorImpl & encryptor)
+    {
+        if (const std::optional<uint64_t> last = PadLastBlock(Padding_, Pending_.data(), PendingSize_, MessageSize_))
+        {
+            State_ = encryptor.EncryptBlock(State_ ^ *last);
+        }
+
+        const uint64_t result = State_;
+
+        Service::SecureErase(Pending_.data(), Pending_.size());
+        Reset();
+
+        return result;
+    }
+
+private:
+    Padding Padding_;
+
+    uint64_t State_;
+    std::array<uint8_t, BLOCK_SIZE_BYTES> Pending_;
+    size_t PendingSize_;
+    uint64_t MessageSize_;
+};
+
+inline bool VerifyTag(const Tag & expected, const uint8_t * tag, size_t tagSize)
+{
+    if (tagSize == 0 || tagSize > expected.size())
+    {
+        return false;
+    }
+
+    return Service::ConstantTimeEqual(expected.data(), tag, tagSize);
+}
+
+} // namespace Chaos::Mac::CbcMac::Inner_
+
+namespace Chaos::Mac::CbcMac
+{
+
+// ISO/IEC 9797-1 MAC algorithm 1 over any 64-bit block encryptor (DES,
+// TDES); the key schedule is expanded once in the constructor.
+template<typename EncryptorImpl,
+         typename = std::enable_if_t<std::is_base_of_v<Cipher::Block::Encryptor<EncryptorImpl>, EncryptorImpl>>>
+class CbcMac
+{
+public:
+    static_assert(EncryptorImpl::BlockSize == BLOCK_SIZE_BYTES);
+
+    explicit CbcMac(const typename EncryptorImpl::Key & key, Padding padding = Padding::Method1)
+        : Encryptor_(key),
+          Chain_(padding)
+    { }
+
+    template<typename InputIt>
+    void Update(InputIt begin, InputIt end)
+    {
+        Chain_.Update(Encryptor_, begin, end);
+    }
+
+    void Reset()
+    {
+        Chain_.Reset();
+    }
+
+    Tag Finish()
+    {
+        Tag result;
+        Cipher::Block::Inner_::StoreBlock64(result.data(), Chain_.Finish(Encryptor_));
+
+        return result;
+    }
+
+    // Checks a tag truncated to its leftmost tagSize bytes.
+    bool Verify(const uint8_t * tag, size_t tagSize)
+    {
+        return Inner_::VerifyTag(Finish(), tag, tagSize);
+    }
+
+private:
+    EncryptorImpl Encryptor_;
+    Inner_::Chain Chain_;
+};
+
+// ISO/IEC 9797-1 MAC algorithm 3 (ANSI X9.19 retail MAC): single-DES
+// CBC-MAC under K1, then decryption under K2 and encryption under K1 of the
+// last block. Two key schedules are kept expanded: an encryptor for K1
+// and a decryptor for K2.
+class RetailMac
+{
+public:
+    static constexpr size_t KEY_SIZE_BYTES = 16;
+    static constexpr size_t LANE_COUNT = 4;
+
+    struct Request
+    {
+        const RetailMac * Key_;
+        const uint8_t * Message_;
+        size_t Size_;
+    };
+
+    template<typename InputIt>
+    RetailMac(InputIt keyBegin, InputIt keyEnd, Padding padding = Padding::Method1)
+        : RetailMac(LoadKey(keyBegin, keyEnd), padding)
+    { }
+
+    template<typename InputIt>
+    void Update(InputIt begin, InputIt end)
+    {
+        Chain_.Update(Encryptor_, begin, end);
+    }
+
+    void Reset()
+    {
+        Chain_.Reset();
+    }
+
+    Tag Finish()
+    {
+        return Output(Chain_.Finish(Encryptor_));
+    }
+
+    bool Verify(const uint8_t * tag, size_t tagSize)
+    {
+        return Inner_::VerifyTag(Finish(), tag, tagSize);
+    }
+
+    // MACs many whole messages, each under its own key. The full blocks of
+    // LANE_COUNT messages are chained side by side so their independent DES
+    // computations overlap; the tails are finished one at a time.
+    static void ComputeBatch(const Request * requests, size_t count, Tag * results)
+    {
+        for (size_t groupBegin = 0; groupBegin < count; groupBegin += LANE_COUNT)
+        {
+            const size_t groupSize = std::min(LANE_COUNT, count - groupBegin);
+
+            const Request * group = requests + groupBegin;
+
+            std::array<uint64_t, LANE_COUNT> states = {};
+            size_t sharedBlocks = group[0].Size_ / BLOCK_SIZE_BYTES;
+
+            for (size_t l = 1; l < groupSize; ++l)
+            {
+                sharedBlocks = std::min(sharedBlocks, group[l].Size_ / BLOCK_SIZE_BYTES);
+            }
+
+            for (size_t block = 0; block < sharedBlocks; ++block)
+            {
+                const size_t offset = block * BLOCK_SIZE_BYTES;
+
+                for (size_t l = 0; l < groupSize; ++l)
+                {
+                    states[l] = group[l].Key_->Encryptor_.EncryptBlock(
+                        states[l] ^ Cipher::Block::Inner_::LoadBlock64(group[l].Message_ + offset));
+                }
+            }
+
+            for (size_t l = 0; l < groupSize; ++l)
+            {
+                const RetailMac & key = *group[l].Key_;
+                const size_t offset = sharedBlocks * BLOCK_SIZE_BYTES;
+
+                uint64_t state = states[l];
+
+                for (size_t o = offset; o + BLOCK_SIZE_BYTES <= group[l].Size_; o += BLOCK_SIZE_BYTES)
+                {
+                    state = key.Encryptor_.EncryptBlock(state ^ Cipher::Block::Inner_::LoadBlock64(group[l].Message_ + o));
+                }
+
+                const size_t tailOffset = group[l].Size_ - group[l].Size_ % BLOCK_SIZE_BYTES;
+                const size_t tailSize = group[l].Size_ - tailOffset;
+
+                if (const std::optional<uint64_t> last =
+                        Inner_::PadLastBlock(key.Padding_, group[l].Message_ + tailOffset, tailSize, group[l].Size_))
+                {
+                    state = key.Encryptor_.EncryptBlock(state ^ *last);
+                }
+
+                results[groupBegin + l] = key.Output(state);
+            }
+        }
+    }
+
+private:
+    using KeyType = std::array<uint8_t, KEY_SIZE_BYTES>;
+
+    Padding Padding_;
+
+    Cipher::Block::Des::DesCrypt::DesEncryptor Encryptor_;
+    Cipher::Block::Des::DesCrypt::DesDecryptor Decryptor_;
+
+    Inner_::Chain Chain_;
+
+    RetailMac(KeyType key, Padding padding)
+        : Padding_(padding),
+          Encryptor_(Cipher::Block::Des::DesCrypt::Key(key.begin(), key.begin() + 8)),
+          Decryptor_(Cipher::Block::Des::DesCrypt::Key(key.begin() + 8, key.end())),
+          Chain_(padding)
+    {
+        Service::SecureErase(key.data(), key.size());
+    }
+
+    template<typename InputIt>
+    static KeyType LoadKey(InputIt keyBegin, InputIt keyEnd)
+    {
+        KeyType result;
+
+        size_t i = 0;
+        InputIt it = keyBegin;
+        for (; i < result.size() && it != keyEnd; ++i, ++it)
+        {
+            result[i] = static_cast<uint8_t>(*it);
+        }
+
+        if (i != result.size() || it != keyEnd)
+        {
+            throw Service::ChaosException("RetailMac: invalid key length (16 bytes required)");
+        }
+
+        return result;
+    }
+
+    Tag Output(uint64_t state) const
+    {
+        Tag result;
+        Cipher::Block::Inner_::StoreBlock64(result.data(), Encryptor_.EncryptBlock(Decryptor_.DecryptBlock(state)));
+
+        return result;
+    }
+};
+
+} // namespace Chaos::Mac::CbcMac
+
+#endif // CHAOS_MAC_CBCMAC_HPP
@@ -3,10 +3,12 @@
 
 #include <array>
 #include <cstdint>
+#include <initializer_list>
 #include <type_traits>
 
 #include "Hash/Hasher.hpp"
 #include "Service/ChaosException.hpp"
+#include "Service/SecureErase.hpp"
 
 namespace Chaos::Mac::Hmac
 {
@@ -39,19 +41,51 @@ public:
         Hasher_.Update(begin, end);
     }
 
+    template<typename SegmentRange,
+             typename = std::enable_if_t<Hash::IsSegmentRange<SegmentRange>>>
+    void Update(const SegmentRange & segments)
+    {
+        EnsureInitialized();
+        Hasher_.Update(segments);
+    }
+
+    void Update(std::initializer_list<Hash::Segment> segments)
+    {
+        EnsureInitialized();
+        Hasher_.Update(segments);
+    }
+
+    void Reset()
+    {
+        EnsureInitialized();
+        Hasher_ = InnerHasher_;
+    }
+
     typename HasherImpl::HashType Finish()
     {
         EnsureInitialized();
 
         auto innerDigest = Hasher_.Finish().GetRawDigest();
 
-        Hasher_.Reset();
+        HasherImpl outerHasher = OuterHasher_;
+        outerHasher.Update(innerDigest.begin(), innerDigest.end());
 
-        KeyType opaddedKey = PadKey<OPAD_BYTE>(Key_);
-        Hasher_.Update(opaddedKey.begin(), opaddedKey.end());
-        Hasher_.Update(innerDigest.begin(), innerDigest.end());
+        Hasher_ = InnerHasher_;
 
-        return Hasher_.Finish();
+        return outerHasher.Finish();
+    }
+
+    // Hasher states after the ipad and opad key blocks.
+    const HasherImpl & GetInnerHasher() const
+    {
+        EnsureInitialized();
+        return InnerHasher_;
+    }
+
+    const HasherImpl & GetOuterHasher() const
+    {
+        EnsureInitialized();
+        return OuterHasher_;
     }
 
 private:
@@ -62,7 +96,8 @@ private:
 
     bool IsInitialized_;
 
-    KeyType Key_;
+    HasherImpl InnerHasher_;
+    HasherImpl OuterHasher_;
     HasherImpl Hasher_;
 
     void EnsureInitialized() const
@@ -133,12 +168,21 @@ private:
     template<typename InputIt>
     void RekeyImpl(InputIt keyBegin, InputIt keyEnd)
     {
-        Key_ = GenerateKey(keyBegin, keyEnd);
-        Hasher_.Reset();
+        KeyType key = GenerateKey(keyBegin, keyEnd);
+        KeyType paddedKey = PadKey<IPAD_BYTE>(key);
+
+        InnerHasher_.Reset();
+        InnerHasher_.Update(paddedKey.begin(), paddedKey.end());
+
+        paddedKey = PadKey<OPAD_BYTE>(key);
+
+        OuterHasher_.Reset();
+        OuterHasher_.Update(paddedKey.begin(), paddedKey.end());
 
-        KeyType ipaddedKey = PadKey<IPAD_BYTE>(Key_);
-        Hasher_.Update(ipaddedKey.begin(), ipaddedKey.end());
+        Service::SecureErase(key.data(), key.size());
+        Service::SecureErase(paddedKey.data(), paddedKey.size());
 
+        Hasher_ = InnerHasher_;
         IsInitialized_ = true;
     }
 };
@@ -0,0 +1,185 @@
+#ifndef CHAOS_PROTOCOL_KERBEROS_RC4HMAC_HPP
+#define CHAOS_PROTOCOL_KERBEROS_RC4HMAC_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#include "Cipher/Arc4/Arc4Crypt.hpp"
+#include "Hash/Md5.hpp"
+#include "Mac/Hmac.hpp"
+#include "Protocol/NtHash.hpp"
+#include "Service/ChaosException.hpp"
+#include "Service/ConstantTime.hpp"
+#include "Service/SecureErase.hpp"
+
+namespace Chaos::Protocol::Kerberos
+{
+
+// RC4-HMAC (etype 23, RFC 4757) keyed with a 16-byte service key.
+// The HMAC-MD5 midstates of the service key and of K1 for the most
+// recently used key usages are kept, so a message costs the MD5 blocks of
+// the data plus a handful of finalizations and one RC4 key setup.
+class Rc4Hmac
+{
+public:
+    using MacType = Mac::Hmac::Hmac<Hash::Md5::Md5Hasher>;
+
+    static constexpr size_t KEY_SIZE_BYTES = 16;
+    static constexpr size_t CHECKSUM_SIZE_BYTES = 16;
+    static constexpr size_t CONFOUNDER_SIZE_BYTES = 8;
+    static constexpr size_t OVERHEAD_SIZE_BYTES = CHECKSUM_SIZE_BYTES + CONFOUNDER_SIZE_BYTES;
+    static constexpr size_t USAGE_CACHE_SIZE = 4;
+    static constexpr size_t CHUNK_SIZE_BYTES = 512;
+
+    template<typename InputIt>
+    Rc4Hmac(InputIt keyBegin, InputIt keyEnd)
+        : NextEntry_(0)
+    {
+        if (std::distance(keyBegin, keyEnd) != static_cast<ptrdiff_t>(KEY_SIZE_BYTES))
+        {
+            throw Service::ChaosException("Rc4Hmac: invalid key length (16 bytes required)");
+        }
+
+        KeyMac_.Rekey(keyBegin, keyEnd);
+    }
+
+    template<typename InputIt>
+    static Rc4Hmac FromPassword(InputIt passwordBegin, InputIt passwordEnd)
+    {
+        auto key = NtHash(passwordBegin, passwordEnd).GetRawDigest();
+        Rc4Hmac result(key.begin(), key.end());
+
+        Service::SecureErase(key.data(), key.size());
+
+        return result;
+    }
+
+    static constexpr uint32_t TranslateUsage(uint32_t usage)
+    {
+        return usage == 3 ? 8 : usage;
+    }
+
+    // out receives the checksum, the encrypted confounder and the encrypted
+    // data: size + OVERHEAD_SIZE_BYTES bytes in total.
+    void Encrypt(uint8_t * out, uint32_t usage, const uint8_t * confounder,
+                 const uint8_t * in, size_t size)
+    {
+        MacType mac = GetUsageMac(usage);
+
+        mac.Update(confounder, confounder + CONFOUNDER_SIZE_BYTES);
+        mac.Update(in, in + size);
+
+        const auto checksum = mac.Finish().GetRawDigest();
+        std::copy(checksum.begin(), checksum.end(), out);
+
+        Cipher::Arc4::Arc4Crypt arc4 = MakeCipher(mac, out);
+
+        arc4.Encrypt(out + CHECKSUM_SIZE_BYTES, confounder, CONFOUNDER_SIZE_BYTES);
+        arc4.Encrypt(out + OVERHEAD_SIZE_BYTES, in, size);
+    }
+
+    // out receives size - OVERHEAD_SIZE_BYTES bytes of plaintext; it is wiped
+    // and false is returned if the checksum does not match.
+    bool Decrypt(uint8_t * out, uint32_t usage, const uint8_t * in, size_t size)
+    {
+        if (size < OVERHEAD_SIZE_BYTES)
+        {
+            throw Service::ChaosException("Rc4Hmac: ciphertext is too short");
+        }
+
+        MacType mac = GetUsageMac(usage);
+        Cipher::Arc4::Arc4Crypt arc4 = MakeCipher(mac, in);
+
+        std::array<uint8_t, CONFOUNDER_SIZE_BYTES> confounder;
+        arc4.Decrypt(confounder.data(), in + CHECKSUM_SIZE_BYTES, CONFOUNDER_SIZE_BYTES);
+        mac.Update(confounder.begin(), confounder.end());
+
+        const uint8_t * data = in + OVERHEAD_SIZE_BYTES;
+        const size_t dataSize = size - OVERHEAD_SIZE_BYTES;
+
+        for (size_t offset = 0; offset < dataSize; offset += CHUNK_SIZE_BYTES)
+        {
+            const size_t chunkSize = std::min(CHUNK_SIZE_BYTES, dataSize - offset);
+
+            arc4.Decrypt(out + offset, data + offset, chunkSize);
+            mac.Update(out + offset, out + offset + chunkSize);
+        }
+
+        const auto expected = mac.Finish().GetRawDigest();
+
+        if (!Service::ConstantTimeEqual(expected.data(), in, CHECKSUM_SIZE_BYTES))
+        {
+            Service::SecureErase(out, dataSize);
+            return false;
+        }
+
+        return true;
+    }
+
+private:
+    struct UsageEntry
+    {
+        bool IsValid_ = false;
+        uint32_t Usage_ = 0;
+        MacType Mac_;
+    };
+
+    MacType KeyMac_;
+    std::array<UsageEntry, USAGE_CACHE_SIZE> Usages_;
+    size_t NextEntry_;
+
+    const MacType & GetUsageMac(uint32_t usage)
+    {
+        const uint32_t salt = TranslateUsage(usage);
+
+        for (const UsageEntry & entry : Usages_)
+        {
+            if (entry.IsValid_ && entry.Usage_ == salt)
+            {
+                return entry.Mac_;
+            }
+        }
+
+        const uint8_t saltBytes[] =
+        {
+            static_cast<uint8_t>(salt),
+            static_cast<uint8_t>(salt >> 8),
+            static_cast<uint8_t>(salt >> 16),
+            static_cast<uint8_t>(salt >> 24)
+        };
+
+        MacType k1Mac = KeyMac_;
+        k1Mac.Update(std::begin(saltBytes), std::end(saltBytes));
+        auto k1 = k1Mac.Finish().GetRawDigest();
+
+        UsageEntry & entry = Usages_[NextEntry_];
+        NextEntry_ = (NextEntry_ + 1) % USAGE_CACHE_SIZE;
+
+        entry.Mac_.Rekey(k1.begin(), k1.end());
+        entry.Usage_ = salt;
+        entry.IsValid_ = true;
+
+        Service::SecureErase(k1.data(), k1.size());
+
+        return entry.Mac_;
+    }
+
+    // K3 = HMAC-MD5(K1, checksum); mac is left ready for reuse under K1.
+    static Cipher::Arc4::Arc4Crypt MakeCipher(MacType & mac, const uint8_t * checksum)
+    {
+        mac.Update(checksum, checksum + CHECKSUM_SIZE_BYTES);
+        auto k3 = mac.Finish().GetRawDigest();
+
+        Cipher::Arc4::Arc4Crypt result(k3.begin(), k3.end());
+        Service::SecureErase(k3.data(), k3.size());
+
+        return result;
+    }
+};
+
+} // namespace Chaos::Protocol::Kerberos
+
+#endif // CHAOS_PROTOCOL_KERBEROS_RC4HMAC_HPP
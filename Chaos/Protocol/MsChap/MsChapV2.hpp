@@ -0,0 +1,307 @@
+#ifndef CHAOS_PROTOCOL_MSCHAP_MSCHAPV2_HPP
+#define CHAOS_PROTOCOL_MSCHAP_MSCHAPV2_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+
+#include "Cipher/Block/Block64.hpp"
+#include "Cipher/Block/Des/DesCrypt.hpp"
+#include "Hash/Md4.hpp"
+#include "Hash/Sha1.hpp"
+#include "Protocol/NtHash.hpp"
+#include "Service/ChaosException.hpp"
+#include "Service/ConstantTime.hpp"
+#include "Service/SecureErase.hpp"
+
+namespace Chaos::Protocol::MsChap::Inner_
+{
+
+inline constexpr char MAGIC1[] = "Magic server to client signing constant";
+inline constexpr char MAGIC2[] = "Pad to make it do more than one iteration";
+
+} // namespace Chaos::Protocol::MsChap::Inner_
+
+namespace Chaos::Protocol::MsChap
+{
+
+using Challenge = std::array<uint8_t, 16>;
+using ChallengeHash = std::array<uint8_t, 8>;
+using NtResponse = std::array<uint8_t, 24>;
+using AuthenticatorResponse = std::array<uint8_t, 20>;
+
+// Spreads 56 key bits over eight bytes, seven per byte, and sets odd parity
+// in the low bit as DES expects.
+inline Cipher::Block::Des::DesCrypt::Key ExpandDesKey(const uint8_t * key56)
+{
+    uint64_t bits = 0;
+
+    for (int_fast8_t i = 0; i < 7; ++i)
+    {
+        bits = (bits << 8) | key56[i];
+    }
+
+    std::array<uint8_t, 8> key;
+
+    for (int_fast8_t i = 0; i < 8; ++i)
+    {
+        uint8_t byte = static_cast<uint8_t>(((bits >> (49 - (i * 7))) & 0x7f) << 1);
+
+        uint8_t parity = byte;
+        parity ^= parity >> 4;
+        parity ^= parity >> 2;
+        parity ^= parity >> 1;
+
+        key[i] = byte | ((parity & 0b1) ^ 0b1);
+    }
+
+    Cipher::Block::Des::DesCrypt::Key result(key.begin(), key.end());
+    Service::SecureErase(key.data(), key.size());
+
+    return result;
+}
+
+inline ChallengeHash ComputeChallengeHash(const uint8_t * peerChallenge,
+                                          const uint8_t * authenticatorChallenge,
+                                          const char * userName, size_t userNameSize)
+{
+    Hash::Sha1::Sha1Hasher hasher;
+
+    hasher.Update(peerChallenge, peerChallenge + std::tuple_size_v<Challenge>);
+    hasher.Update(authenticatorChallenge, authenticatorChallenge + std::tuple_size_v<Challenge>);
+    hasher.Update(userName, userName + userNameSize);
+
+    const auto digest = hasher.Finish().GetRawDigest();
+
+    ChallengeHash result;
+    std::copy_n(digest.begin(), result.size(), result.begin());
+
+    return result;
+}
+
+// Everything a server needs to check MS-CHAPv2 logins for one account: the
+// three DES key schedules derived from the NT hash and the hash of the NT
+// hash. Building it runs the DES key schedule three times, so servers keep
+// one per account instead of rebuilding it on every login.
+class Credential
+{
+public:
+    static constexpr size_t NT_HASH_SIZE_BYTES = 16;
+
+    template<typename InputIt>
+    Credential(InputIt ntHashBegin, InputIt ntHashEnd)
+        : Credential(LoadNtHash(ntHashBegin, ntHashEnd))
+    { }
+
+    template<typename InputIt>
+    static Credential FromPassword(InputIt passwordBegin, InputIt passwordEnd)
+    {
+        auto ntHash = NtHash(passwordBegin, passwordEnd).GetRawDigest();
+        Credential result(ntHash.begin(), ntHash.end());
+
+        Service::SecureErase(ntHash.data(), ntHash.size());
+
+        return result;
+    }
+
+    NtResponse ComputeNtResponse(const ChallengeHash & challengeHash) const
+    {
+        const uint64_t block = Cipher::Block::Inner_::LoadBlock64(challengeHash.data());
+
+        NtResponse result;
+
+        for (size_t i = 0; i < Encryptors_.size(); ++i)
+        {
+            Cipher::Block::Inner_::StoreBlock64(result.data() + i * 8, Encryptors_[i].EncryptBlock(block));
+        }
+
+        return result;
+    }
+
+    AuthenticatorResponse ComputeAuthenticatorResponse(const NtResponse & ntResponse,
+                                                       const ChallengeHash & challengeHash) const
+    {
+        Hash::Sha1::Sha1Hasher hasher;
+
+        hasher.Update(PasswordHashHash_.begin(), PasswordHashHash_.end());
+        hasher.Update(ntResponse.begin(), ntResponse.end());
+        hasher.Update(std::begin(Inner_::MAGIC1), std::end(Inner_::MAGIC1) - 1);
+
+        const auto digest = hasher.Finish().GetRawDigest();
+
+        hasher.Reset();
+        hasher.Update(digest.begin(), digest.end());
+        hasher.Update(challengeHash.begin(), challengeHash.end());
+        hasher.Update(std::begin(Inner_::MAGIC2), std::end(Inner_::MAGIC2) - 1);
+
+        return hasher.Finish().GetRawDigest();
+    }
+
+private:
+    using NtHashType = std::array<uint8_t, NT_HASH_SIZE_BYTES>;
+
+    std::array<Cipher::Block::Des::DesCrypt::DesEncryptor, 3> Encryptors_;
+    std::array<uint8_t, 16> PasswordHashHash_;
+
+    explicit Credential(NtHashType ntHash)
+        : Encryptors_(MakeEncryptors(ntHash)),
+          PasswordHashHash_(HashNtHash(ntHash))
+    {
+        Service::SecureErase(ntHash.data(), ntHash.size());
+    }
+
+    template<typename InputIt>
+    static NtHashType LoadNtHash(InputIt ntHashBegin, InputIt ntHashEnd)
+    {
+        NtHashType result;
+
+        size_t i = 0;
+        InputIt it = ntHashBegin;
+        for (; i < result.size() && it != ntHashEnd; ++i, ++it)
+        {
+            result[i] = static_cast<uint8_t>(*it);
+        }
+
+        if (i != result.size() || it != ntHashEnd)
+        {
+            throw Service::ChaosException("MsChap::Credential: invalid NT hash length "
+                                          "(16 bytes required)");
+        }
+
+        return result;
+    }
+
+    static std::array<Cipher::Block::Des::DesCrypt::DesEncryptor, 3> MakeEncryptors(const NtHashType & ntHash)
+    {
+        std::array<uint8_t, 21> padded = {};
+        std::copy(ntHash.begin(), ntHash.end(), padded.begin());
+
+        std::array<Cipher::Block::Des::DesCrypt::DesEncryptor, 3> result =
+        {
+            Cipher::Block::Des::DesCrypt::DesEncryptor(ExpandDesKey(padded.data())),
+            Cipher::Block::Des::DesCrypt::DesEncryptor(ExpandDesKey(padded.data() + 7)),
+            Cipher::Block::Des::DesCrypt::DesEncryptor(ExpandDesKey(padded.data() + 14))
+        };
+
+        Service::SecureErase(padded.data(), padded.size());
+
+        return result;
+    }
+
+    static std::array<uint8_t, 16> HashNtHash(const NtHashType & ntHash)
+    {
+        Hash::Md4::Md4Hasher hasher;
+        hasher.Update(ntHash.begin(), ntHash.end());
+
+        return hasher.Finish().GetRawDigest();
+    }
+};
+
+struct VerifyRequest
+{
+    const Credential * Credential_;
+    const uint8_t * AuthenticatorChallenge_;
+    const uint8_t * PeerChallenge_;
+    const char * UserName_;
+    size_t UserNameSize_;
+    const uint8_t * NtResponse_;
+};
+
+struct VerifyResult
+{
+    bool IsValid_;
+    AuthenticatorResponse AuthenticatorResponse_;
+};
+
+// Checks the peer's NT-Response and, if it matches, produces the
+// authenticator response the server sends back ("S=" + upper-case hex).
+inline VerifyResult Verify(const VerifyRequest & request)
+{
+    const ChallengeHash challengeHash = ComputeChallengeHash(request.PeerChallenge_,
+                                                             request.AuthenticatorChallenge_,
+                                                             request.UserName_,
+                                                             request.UserNameSize_);
+
+    const NtResponse expected = request.Credential_->ComputeNtResponse(challengeHash);
+
+    VerifyResult result = {};
+    result.IsValid_ = Service::ConstantTimeEqual(expected.data(), request.NtResponse_, expected.size());
+
+    if (result.IsValid_)
+    {
+        result.AuthenticatorResponse_ = request.Credential_->ComputeAuthenticatorResponse(expected, challengeHash);
+    }
+
+    return result;
+}
+
+// Verifies requests in groups, one stage at a time: all challenge hashes of a
+// group, then all DES responses, then the authenticator responses of the
+// logins that passed.
+inline void VerifyBatch(const VerifyRequest * requests, size_t count, VerifyResult * results)
+{
+    constexpr size_t GROUP_SIZE = 8;
+
+    for (size_t groupBegin = 0; groupBegin < count; groupBegin += GROUP_SIZE)
+    {
+        const size_t groupSize = std::min(GROUP_SIZE, count - groupBegin);
+
+        const VerifyRequest * group = requests + groupBegin;
+        VerifyResult * groupResults = results + groupBegin;
+
+        std::array<ChallengeHash, GROUP_SIZE> challengeHashes;
+        std::array<NtResponse, GROUP_SIZE> expected;
+
+        for (size_t i = 0; i < groupSize; ++i)
+        {
+            challengeHashes[i] = ComputeChallengeHash(group[i].PeerChallenge_,
+                                                      group[i].AuthenticatorChallenge_,
+                                                      group[i].UserName_,
+                                                      group[i].UserNameSize_);
+        }
+
+        for (size_t i = 0; i < groupSize; ++i)
+        {
+            expected[i] = group[i].Credential_->ComputeNtResponse(challengeHashes[i]);
+        }
+
+        for (size_t i = 0; i < groupSize; ++i)
+        {
+            groupResults[i] = {};
+            groupResults[i].IsValid_ = Service::ConstantTimeEqual(expected[i].data(), group[i].NtResponse_,
+                                                                  expected[i].size());
+        }
+
+        for (size_t i = 0; i < groupSize; ++i)
+        {
+            if (groupResults[i].IsValid_)
+            {
+                groupResults[i].AuthenticatorResponse_ =
+                    group[i].Credential_->ComputeAuthenticatorResponse(expected[i], challengeHashes[i]);
+            }
+        }
+    }
+}
+
+inline std::string ToAuthenticatorString(const AuthenticatorResponse & response)
+{
+    constexpr char HEX_DIGITS[] = "0123456789ABCDEF";
+
+    std::string result = "S=";
+    result.reserve(2 + 2 * response.size());
+
+    for (uint8_t byte : response)
+    {
+        result.push_back(HEX_DIGITS[byte >> 4]);
+        result.push_back(HEX_DIGITS[byte & 0x0f]);
+    }
+
+    return result;
+}
+
+} // namespace Chaos::Protocol::MsChap
+
+#endif // CHAOS_PROTOCOL_MSCHAP_MSCHAPV2_HPP
@@ -0,0 +1,37 @@
+#ifndef CHAOS_PROTOCOL_NTHASH_HPP
+#define CHAOS_PROTOCOL_NTHASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "Hash/Md4.hpp"
+#include "Service/Utf8.hpp"
+
+namespace Chaos::Protocol
+{
+
+// MD4 over the UTF-16LE form of a UTF-8 password; the transcoded
+// bytes are streamed straight into the hasher.
+template<typename InputIt>
+Hash::Md4::Md4Hash NtHash(InputIt passwordBegin, InputIt passwordEnd)
+{
+    Hash::Md4::Md4Hasher hasher;
+
+    Service::Utf8ToUtf16Le(passwordBegin, passwordEnd,
+                           [&hasher](const uint8_t * data, size_t size)
+                           {
+                               hasher.Update(data, data + size);
+                           });
+
+    return hasher.Finish();
+}
+
+inline Hash::Md4::Md4Hash NtHash(const char * password)
+{
+    return NtHash(password, password + std::strlen(password));
+}
+
+} // namespace Chaos::Protocol
+
+#endif // CHAOS_PROTOCOL_NTHASH_HPP
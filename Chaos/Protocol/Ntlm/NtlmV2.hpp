@@ -0,0 +1,255 @@
+#ifndef CHAOS_PROTOCOL_NTLM_NTLMV2_HPP
+#define CHAOS_PROTOCOL_NTLM_NTLMV2_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <tuple>
+
+#include "Hash/Md5.hpp"
+#include "Mac/Hmac.hpp"
+#include "Protocol/NtHash.hpp"
+#include "Service/ChaosException.hpp"
+#include "Service/ConstantTime.hpp"
+#include "Service/SecureErase.hpp"
+#include "Service/Utf8.hpp"
+
+namespace Chaos::Protocol::Ntlm::Inner_
+{
+
+// Simple upper-case mapping for ASCII, Latin-1, Latin Extended-A, Greek and
+// Cyrillic; other code points are left as they are.
+inline constexpr uint32_t ToUpper(uint32_t codePoint)
+{
+    if (codePoint < 0x80)
+    {
+        return codePoint >= 'a' && codePoint <= 'z' ? codePoint - 0x20 : codePoint;
+    }
+
+    if (codePoint >= 0xe0 && codePoint <= 0xfe && codePoint != 0xf7)
+    {
+        return codePoint - 0x20;
+    }
+
+    if (codePoint == 0xff)
+    {
+        return 0x178;
+    }
+
+    // Dotless i is the odd one out of the Latin Extended-A pairs: its
+    // upper case is plain I, while U+0130 is already upper case.
+    if (codePoint == 0x131)
+    {
+        return 'I';
+    }
+
+    if ((codePoint >= 0x100 && codePoint <= 0x137) || (codePoint >= 0x14a && codePoint <= 0x177))
+    {
+        return codePoint & ~static_cast<uint32_t>(0b1);
+    }
+
+    if ((codePoint >= 0x139 && codePoint <= 0x148) || (codePoint >= 0x179 && codePoint <= 0x17e))
+    {
+        return (codePoint & 0b1) == 0 ? codePoint - 1 : codePoint;
+    }
+
+    if (codePoint == 0x3c2)
+    {
+        return 0x3a3;
+    }
+
+    if ((codePoint >= 0x3b1 && codePoint <= 0x3c9) || (codePoint >= 0x430 && codePoint <= 0x44f))
+    {
+        return codePoint - 0x20;
+    }
+
+    if (codePoint >= 0x450 && codePoint <= 0x45f)
+    {
+        return codePoint - 0x50;
+    }
+
+    return codePoint;
+}
+
+struct UpperCaseCodePoint
+{
+    constexpr uint32_t operator()(uint32_t codePoint) const
+    {
+        return ToUpper(codePoint);
+    }
+};
+
+} // namespace Chaos::Protocol::Ntlm::Inner_
+
+namespace Chaos::Protocol::Ntlm
+{
+
+using NtProof = std::array<uint8_t, 16>;
+using SessionKey = std::array<uint8_t, 16>;
+using LmV2Response = std::array<uint8_t, 24>;
+
+inline constexpr size_t CHALLENGE_SIZE_BYTES = 8;
+inline constexpr size_t MIN_BLOB_SIZE_BYTES = 28;
+
+// HMAC-MD5 midstate for a ResponseKeyNT (NTOWFv2). Each response then costs
+// only the MD5 blocks of the server challenge and the client blob.
+class ResponseKey
+{
+public:
+    static constexpr size_t KEY_SIZE_BYTES = 16;
+
+    template<typename InputIt>
+    ResponseKey(InputIt keyBegin, InputIt keyEnd)
+    {
+        if (std::distance(keyBegin, keyEnd) != static_cast<ptrdiff_t>(KEY_SIZE_BYTES))
+        {
+            throw Service::ChaosException("Ntlm::ResponseKey: invalid key length (16 bytes required)");
+        }
+
+        Mac_.Rekey(keyBegin, keyEnd);
+    }
+
+    NtProof ComputeNtProof(const uint8_t * serverChallenge, const uint8_t * blob, size_t blobSize) const
+    {
+        Mac::Hmac::Hmac<Hash::Md5::Md5Hasher> mac = Mac_;
+
+        mac.Update(serverChallenge, serverChallenge + CHALLENGE_SIZE_BYTES);
+        mac.Update(blob, blob + blobSize);
+
+        return mac.Finish().GetRawDigest();
+    }
+
+    SessionKey ComputeSessionBaseKey(const NtProof & ntProof) const
+    {
+        Mac::Hmac::Hmac<Hash::Md5::Md5Hasher> mac = Mac_;
+        mac.Update(ntProof.begin(), ntProof.end());
+
+        return mac.Finish().GetRawDigest();
+    }
+
+    LmV2Response ComputeLmV2Response(const uint8_t * serverChallenge, const uint8_t * clientChallenge) const
+    {
+        const NtProof proof = ComputeNtProof(serverChallenge, clientChallenge, CHALLENGE_SIZE_BYTES);
+
+        LmV2Response result;
+        std::copy(proof.begin(), proof.end(), result.begin());
+        std::copy(clientChallenge, clientChallenge + CHALLENGE_SIZE_BYTES, result.begin() + proof.size());
+
+        return result;
+    }
+
+private:
+    Mac::Hmac::Hmac<Hash::Md5::Md5Hasher> Mac_;
+};
+
+// HMAC-MD5 midstate keyed by one account's NT hash. Kept per user, it turns
+// NTOWFv2 for any user/domain spelling into a couple of MD5 blocks.
+class Credential
+{
+public:
+    static constexpr size_t NT_HASH_SIZE_BYTES = 16;
+
+    template<typename InputIt>
+    Credential(InputIt ntHashBegin, InputIt ntHashEnd)
+    {
+        if (std::distance(ntHashBegin, ntHashEnd) != static_cast<ptrdiff_t>(NT_HASH_SIZE_BYTES))
+        {
+            throw Service::ChaosException("Ntlm::Credential: invalid NT hash length (16 bytes required)");
+        }
+
+        NtHashMac_.Rekey(ntHashBegin, ntHashEnd);
+    }
+
+    template<typename InputIt>
+    static Credential FromPassword(InputIt passwordBegin, InputIt passwordEnd)
+    {
+        auto ntHash = NtHash(passwordBegin, passwordEnd).GetRawDigest();
+        Credential result(ntHash.begin(), ntHash.end());
+
+        Service::SecureErase(ntHash.data(), ntHash.size());
+
+        return result;
+    }
+
+    // NTOWFv2: HMAC-MD5 over UTF-16LE(upper-case user name + domain), both
+    // given as UTF-8 and transcoded straight into the MAC.
+    template<typename UserIt, typename DomainIt>
+    ResponseKey DeriveResponseKey(UserIt userBegin, UserIt userEnd,
+                                  DomainIt domainBegin, DomainIt domainEnd) const
+    {
+        Mac::Hmac::Hmac<Hash::Md5::Md5Hasher> mac = NtHashMac_;
+
+        auto sink = [&mac](const uint8_t * data, size_t size)
+        {
+            mac.Update(data, data + size);
+        };
+
+        Service::Utf8ToUtf16Le(userBegin, userEnd, sink, Inner_::UpperCaseCodePoint());
+        Service::Utf8ToUtf16Le(domainBegin, domainEnd, sink);
+
+        auto key = mac.Finish().GetRawDigest();
+        ResponseKey result(key.begin(), key.end());
+
+        Service::SecureErase(key.data(), key.size());
+
+        return result;
+    }
+
+private:
+    Mac::Hmac::Hmac<Hash::Md5::Md5Hasher> NtHashMac_;
+};
+
+struct VerifyRequest
+{
+    const ResponseKey * Key_;
+    const uint8_t * ServerChallenge_;
+    const uint8_t * NtResponse_;
+    size_t NtResponseSize_;
+};
+
+struct VerifyResult
+{
+    bool IsValid_;
+    SessionKey SessionBaseKey_;
+};
+
+// NtResponse_ is NTProofStr followed by the client blob; responses too short
+// to hold both are rejected.
+inline VerifyResult Verify(const VerifyRequest & request)
+{
+    VerifyResult result = {};
+
+    const size_t proofSize = std::tuple_size_v<NtProof>;
+
+    if (request.NtResponseSize_ < proofSize + MIN_BLOB_SIZE_BYTES)
+    {
+        return result;
+    }
+
+    const NtProof expected = request.Key_->ComputeNtProof(request.ServerChallenge_,
+                                                          request.NtResponse_ + proofSize,
+                                                          request.NtResponseSize_ - proofSize);
+
+    result.IsValid_ = Service::ConstantTimeEqual(expected.data(), request.NtResponse_, proofSize);
+
+    if (result.IsValid_)
+    {
+        result.SessionBaseKey_ = request.Key_->ComputeSessionBaseKey(expected);
+    }
+
+    return result;
+}
+
+inline void VerifyBatch(const VerifyRequest * requests, size_t count, VerifyResult * results)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        results[i] = Verify(requests[i]);
+    }
+}
+
+} // namespace Chaos::Protocol::Ntlm
+
+#endif // CHAOS_PROTOCOL_NTLM_NTLMV2_HPP
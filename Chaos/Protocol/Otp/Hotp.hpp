@@ -0,0 +1,345 @@
+#ifndef CHAOS_PROTOCOL_OTP_HOTP_HPP
+#define CHAOS_PROTOCOL_OTP_HOTP_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include "Hash/Hasher.hpp"
+#include "Hash/MerkleDamgard.hpp"
+#include "Hash/Sha1.hpp"
+#include "Mac/Hmac.hpp"
+#include "Service/ChaosException.hpp"
+#include "Service/ConstantTime.hpp"
+#include "Service/SecureErase.hpp"
+
+namespace Chaos::Protocol::Otp
+{
+
+inline constexpr size_t COUNTER_SIZE_BYTES = 8;
+inline constexpr size_t MIN_DIGITS = 6;
+inline constexpr size_t MAX_DIGITS = 8;
+inline constexpr size_t MAX_LOOK_AHEAD = 1000;
+
+} // namespace Chaos::Protocol::Otp
+
+namespace Chaos::Protocol::Otp::Inner_
+{
+
+inline constexpr uint32_t POWERS_OF_TEN[MAX_DIGITS + 1] =
+{
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000
+};
+
+// HMAC of 8-byte big-endian counters. Both the inner and the outer hash
+// then end in a single padded block after the cached key-block midstate,
+// so each counter costs exactly two compressions.
+template<typename HasherImpl>
+class CounterMac
+{
+public:
+    using Engine = typename HasherImpl::Engine;
+
+    static constexpr size_t DIGEST_SIZE_BYTES = Engine::DIGEST_SIZE_BYTES;
+    static constexpr size_t LANE_COUNT = 4;
+
+    static_assert(DIGEST_SIZE_BYTES >= 20, "CounterMac: dynamic truncation needs at least a 20-byte digest");
+
+    template<typename InputIt>
+    CounterMac(InputIt secretBegin, InputIt secretEnd)
+        : Mac_(secretBegin, secretEnd)
+    { }
+
+    // codes[i] receives the dynamically truncated 31-bit value (RFC 4226
+    // 5.3) for counter firstCounter + i. Counters are run LANE_COUNT at a
+    // time through each compression.
+    void Truncate(uint64_t firstCounter, size_t count, uint32_t * codes) const
+    {
+        static const Block INNER_PADDING_BLOCK = Engine::MakeFinalBlock(BLOCK_SIZE_BYTES, COUNTER_SIZE_BYTES);
+        static const Block OUTER_PADDING_BLOCK = Engine::MakeFinalBlock(BLOCK_SIZE_BYTES, DIGEST_SIZE_BYTES);
+
+        const Buffer & innerState = Mac_.GetInnerHasher().GetEngine().GetBuffer();
+        const Buffer & outerState = Mac_.GetOuterHasher().GetEngine().GetBuffer();
+
+        for (size_t groupBegin = 0; groupBegin < count; groupBegin += LANE_COUNT)
+        {
+            const size_t groupSize = std::min(LANE_COUNT, count - groupBegin);
+
+            std::array<Buffer, LANE_COUNT> buffers;
+            std::array<Block, LANE_COUNT> blocks;
+
+            for (size_t l = 0; l < groupSize; ++l)
+            {
+                const uint64_t counter = firstCounter + groupBegin + l;
+
+                uint8_t counterBytes[COUNTER_SIZE_BYTES];
+
+                for (size_t i = 0; i < COUNTER_SIZE_BYTES; ++i)
+                {
+                    counterBytes[i] = static_cast<uint8_t>(counter >> (56 - i * 8));
+                }
+
+                blocks[l] = INNER_PADDING_BLOCK;
+                blocks[l][0] = Engine::LoadWord(counterBytes);
+                blocks[l][1] = Engine::LoadWord(counterBytes + sizeof(Word));
+
+                buffers[l] = innerState;
+                Engine::Compress(buffers[l], blocks[l]);
+            }
+
+            for (size_t l = 0; l < groupSize; ++l)
+            {
+                blocks[l] = OUTER_PADDING_BLOCK;
+                std::copy(std::begin(buffers[l].Regs_), std::end(buffers[l].Regs_), blocks[l].begin());
+
+                buffers[l] = outerState;
+                Engine::Compress(buffers[l], blocks[l]);
+            }
+
+            for (size_t l = 0; l < groupSize; ++l)
+            {
+                std::array<uint8_t, DIGEST_SIZE_BYTES> digest;
+
+                for (size_t w = 0; w < std::size(buffers[l].Regs_); ++w)
+                {
+                    Engine::StoreWord(digest.data() + w * sizeof(Word), buffers[l].Regs_[w]);
+                }
+
+                const size_t offset = digest[DIGEST_SIZE_BYTES - 1] & 0x0f;
+
+                codes[groupBegin + l] = ((static_cast<uint32_t>(digest[offset]) & 0x7f) << 24) |
+                                        (static_cast<uint32_t>(digest[offset + 1]) << 16) |
+                                        (static_cast<uint32_t>(digest[offset + 2]) << 8) |
+                                        static_cast<uint32_t>(digest[offset + 3]);
+
+                Service::SecureErase(digest.data(), digest.size());
+            }
+
+            Service::SecureErase(buffers.data(), sizeof(buffers));
+            Service::SecureErase(blocks.data(), sizeof(blocks));
+        }
+    }
+
+private:
+    using Buffer = typename Engine::Buffer;
+    using Block = typename Engine::Block;
+    using Word = typename Engine::Word;
+
+    static constexpr size_t BLOCK_SIZE_BYTES = Engine::BLOCK_SIZE_BYTES;
+
+    static_assert(COUNTER_SIZE_BYTES % sizeof(Word) == 0 && COUNTER_SIZE_BYTES / sizeof(Word) == 2);
+    static_assert(DIGEST_SIZE_BYTES + 1 + Engine::LENGTH_SIZE_BYTES <= BLOCK_SIZE_BYTES);
+
+    Mac::Hmac::Hmac<HasherImpl> Mac_;
+};
+
+} // namespace Chaos::Protocol::Otp::Inner_
+
+namespace Chaos::Protocol::Otp
+{
+
+// RFC 4226 HMAC-based one-time passwords. The secret is keyed into the
+// HMAC midstates once; a look-ahead window is computed in one multi-lane
+// pass and every candidate is compared in constant time.
+template<typename HasherImpl = Hash::Sha1::Sha1Hasher,
+         typename = std::enable_if_t<std::is_base_of_v<Hash::Hasher<HasherImpl>, HasherImpl>>>
+class Hotp
+{
+public:
+    template<typename InputIt>
+    Hotp(InputIt secretBegin, InputIt secretEnd, size_t digits = MIN_DIGITS)
+        : Mac_(secretBegin, secretEnd),
+          Digits_(digits),
+          Modulus_(0)
+    {
+        if (digits < MIN_DIGITS || digits > MAX_DIGITS)
+        {
+            throw Service::ChaosException("Otp::Hotp: invalid number of digits (6 to 8 allowed)");
+        }
+
+        Modulus_ = Inner_::POWERS_OF_TEN[digits];
+    }
+
+    uint32_t Generate(uint64_t counter) const
+    {
+        uint32_t result;
+        GenerateWindow(counter, 1, &result);
+
+        return result;
+    }
+
+    // codes[i] receives the code for counter firstCounter + i.
+    void GenerateWindow(uint64_t firstCounter, size_t count, uint32_t * codes) const
+    {
+        Mac_.Truncate(firstCounter, count, codes);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            codes[i] %= Modulus_;
+        }
+    }
+
+    // The code zero-padded to the configured number of digits.
+    std::string Format(uint32_t code) const
+    {
+        std::string result(Digits_, '0');
+
+        for (size_t i = Digits_; i > 0; --i, code /= 10)
+        {
+            result[i - 1] = static_cast<char>('0' + code % 10);
+        }
+
+        return result;
+    }
+
+    // Checks code against counters counter .. counter + lookAhead and
+    // returns the matching one, from which the next expected counter
+    // follows. All candidates are compared, whichever one matches. The
+    // window stops at the largest counter.
+    std::optional<uint64_t> Verify(const std::string & code, uint64_t counter, size_t lookAhead) const
+    {
+        if (lookAhead > MAX_LOOK_AHEAD)
+        {
+            throw Service::ChaosException("Otp::Hotp: look-ahead window is too large");
+        }
+
+        lookAhead = static_cast<size_t>(std::min<uint64_t>(lookAhead, std::numeric_limits<uint64_t>::max() - counter));
+
+        const std::optional<uint32_t> value = ParseCode(code);
+
+        if (!value)
+        {
+            return std::nullopt;
+        }
+
+        uint64_t matched = 0;
+        uint64_t isMatched = 0;
+
+        std::array<uint32_t, LANE_COUNT> codes;
+
+        for (size_t groupBegin = 0; groupBegin <= lookAhead; groupBegin += LANE_COUNT)
+        {
+            const size_t groupSize = std::min(LANE_COUNT, lookAhead - groupBegin + 1);
+
+            GenerateWindow(counter + groupBegin, groupSize, codes.data());
+
+            for (size_t l = 0; l < groupSize; ++l)
+            {
+                const uint64_t mask = static_cast<uint64_t>(0) -
+                    static_cast<uint64_t>(Service::ConstantTimeEqual(&codes[l], &*value, sizeof(uint32_t)));
+
+                matched |= (counter + groupBegin + l) & mask & ~isMatched;
+                isMatched |= mask;
+            }
+        }
+
+        Service::SecureErase(codes.data(), sizeof(codes));
+
+        if (isMatched == 0)
+        {
+            return std::nullopt;
+        }
+
+        return matched;
+    }
+
+private:
+    static constexpr size_t LANE_COUNT = Inner_::CounterMac<HasherImpl>::LANE_COUNT;
+
+    Inner_::CounterMac<HasherImpl> Mac_;
+    size_t Digits_;
+    uint32_t Modulus_;
+
+    std::optional<uint32_t> ParseCode(const std::string & code) const
+    {
+        if (code.size() != Digits_)
+        {
+            return std::nullopt;
+        }
+
+        uint32_t result = 0;
+
+        for (char c : code)
+        {
+            if (c < '0' || c > '9')
+            {
+                return std::nullopt;
+            }
+
+            result = result * 10 + static_cast<uint32_t>(c - '0');
+        }
+
+        return result;
+    }
+};
+
+// RFC 6238 time-based one-time passwords: HOTP over the number of
+// timeStep-second steps since startTime.
+template<typename HasherImpl = Hash::Sha1::Sha1Hasher>
+class Totp
+{
+public:
+    template<typename InputIt>
+    Totp(InputIt secretBegin, InputIt secretEnd, size_t digits = MIN_DIGITS,
+         uint64_t timeStep = 30, uint64_t startTime = 0)
+        : Hotp_(secretBegin, secretEnd, digits),
+          TimeStep_(timeStep),
+          StartTime_(startTime)
+    {
+        if (timeStep == 0)
+        {
+            throw Service::ChaosException("Otp::Totp: time step must be positive");
+        }
+    }
+
+    uint64_t GetTimeCounter(uint64_t unixTime) const
+    {
+        if (unixTime < StartTime_)
+        {
+            throw Service::ChaosException("Otp::Totp: time is before the start time");
+        }
+
+        return (unixTime - StartTime_) / TimeStep_;
+    }
+
+    uint32_t Generate(uint64_t unixTime) const
+    {
+        return Hotp_.Generate(GetTimeCounter(unixTime));
+    }
+
+    std::string Format(uint32_t code) const
+    {
+        return Hotp_.Format(code);
+    }
+
+    // Accepts codes up to driftSteps time steps behind or ahead of
+    // unixTime and returns the matching time counter, which callers
+    // record to reject replays.
+    std::optional<uint64_t> Verify(const std::string & code, uint64_t unixTime, size_t driftSteps) const
+    {
+        if (driftSteps > MAX_LOOK_AHEAD / 2)
+        {
+            throw Service::ChaosException("Otp::Totp: drift window is too large");
+        }
+
+        const uint64_t counter = GetTimeCounter(unixTime);
+        const uint64_t first = counter - std::min<uint64_t>(counter, driftSteps);
+
+        return Hotp_.Verify(code, first, static_cast<size_t>(counter - first) + driftSteps);
+    }
+
+private:
+    Hotp<HasherImpl> Hotp_;
+    uint64_t TimeStep_;
+    uint64_t StartTime_;
+};
+
+} // namespace Chaos::Protocol::Otp
+
+#endif // CHAOS_PROTOCOL_OTP_HOTP_HPP
@@ -0,0 +1,460 @@
+#ifndef CHAOS_PROTOCOL_RADIUS_RADIUSCRYPTO_HPP
+#define CHAOS_PROTOCOL_RADIUS_RADIUSCRYPTO_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Hash/Md5.hpp"
+#include "Mac/Hmac.hpp"
+#include "Service/ChaosException.hpp"
+#include "Service/ConstantTime.hpp"
+#include "Service/SecureAllocator.hpp"
+#include "Service/SecureErase.hpp"
+
+namespace Chaos::Protocol::Radius
+{
+
+using Authenticator = std::array<uint8_t, 16>;
+
+// Per-client RADIUS crypto: packet authenticators (RFC 2865, 2866, 5176),
+// Message-Authenticator (RFC 3579) and User-Password / Tunnel-Password
+// hiding (RFC 2865, 2868). The MD5 state over the shared secret and the
+// keyed HMAC-MD5 state are built once, so hiding chains and MACs never
+// hash the secret again.
+class SharedSecret
+{
+public:
+    static constexpr size_t HEADER_SIZE_BYTES = 20;
+    static constexpr size_t AUTHENTICATOR_OFFSET = 4;
+    static constexpr size_t AUTHENTICATOR_SIZE_BYTES = 16;
+    static constexpr size_t MAX_PACKET_SIZE_BYTES = 4096;
+    static constexpr size_t MAX_PASSWORD_SIZE_BYTES = 128;
+    static constexpr size_t MAX_TUNNEL_PASSWORD_SIZE_BYTES = 239;
+    static constexpr size_t MAX_HIDDEN_TUNNEL_PASSWORD_SIZE_BYTES = 240;
+    static constexpr size_t SALT_SIZE_BYTES = 2;
+
+    static constexpr uint8_t ACCESS_REQUEST = 1;
+    static constexpr uint8_t ACCOUNTING_REQUEST = 4;
+    static constexpr uint8_t STATUS_SERVER = 12;
+    static constexpr uint8_t DISCONNECT_REQUEST = 40;
+    static constexpr uint8_t COA_REQUEST = 43;
+
+    static constexpr uint8_t MESSAGE_AUTHENTICATOR = 80;
+
+    template<typename InputIt>
+    SharedSecret(InputIt secretBegin, InputIt secretEnd)
+        : Secret_(secretBegin, secretEnd)
+    {
+        if (Secret_.empty())
+        {
+            throw Service::ChaosException("Radius::SharedSecret: secret is empty");
+        }
+
+        SecretHasher_.Update(Secret_.begin(), Secret_.end());
+        Mac_.Rekey(Secret_.begin(), Secret_.end());
+    }
+
+    static constexpr size_t GetHiddenPasswordSize(size_t passwordSize)
+    {
+        return passwordSize == 0 ? AUTHENTICATOR_SIZE_BYTES : PadToBlock(passwordSize);
+    }
+
+    static constexpr size_t GetHiddenTunnelPasswordSize(size_t passwordSize)
+    {
+        return SALT_SIZE_BYTES + PadToBlock(passwordSize + 1);
+    }
+
+    // Writes GetHiddenPasswordSize(size) bytes into out.
+    void HidePassword(uint8_t * out, const uint8_t * password, size_t size,
+                      const uint8_t * requestAuthenticator) const
+    {
+        if (size > MAX_PASSWORD_SIZE_BYTES)
+        {
+            throw Service::ChaosException("Radius::SharedSecret: password is too long");
+        }
+
+        const size_t hiddenSize = GetHiddenPasswordSize(size);
+
+        std::copy(password, password + size, out);
+        std::fill(out + size, out + hiddenSize, 0);
+
+        HideChain(out, hiddenSize, requestAuthenticator, nullptr);
+    }
+
+    // Returns the password length with the trailing padding stripped.
+    size_t RevealPassword(uint8_t * out, const uint8_t * hidden, size_t size,
+                          const uint8_t * requestAuthenticator) const
+    {
+        if (size == 0 || size % AUTHENTICATOR_SIZE_BYTES != 0 || size > MAX_PASSWORD_SIZE_BYTES)
+        {
+            throw Service::ChaosException("Radius::SharedSecret: invalid hidden password size");
+        }
+
+        RevealChain(out, hidden, size, requestAuthenticator, nullptr);
+
+        while (size > 0 && out[size - 1] == 0)
+        {
+            --size;
+        }
+
+        return size;
+    }
+
+    // Writes GetHiddenTunnelPasswordSize(size) bytes into out: the salt
+    // followed by the hidden length-prefixed password.
+    void HideTunnelPassword(uint8_t * out, const uint8_t * password, size_t size,
+                            const uint8_t * requestAuthenticator, const uint8_t * salt) const
+    {
+        if (size > MAX_TUNNEL_PASSWORD_SIZE_BYTES)
+        {
+            throw Service::ChaosException("Radius::SharedSecret: tunnel password is too long");
+        }
+
+        if ((salt[0] & 0x80) == 0)
+        {
+            throw Service::ChaosException("Radius::SharedSecret: salt must have its most significant bit set");
+        }
+
+        const size_t hiddenSize = GetHiddenTunnelPasswordSize(size) - SALT_SIZE_BYTES;
+        uint8_t * hidden = out + SALT_SIZE_BYTES;
+
+        std::copy(salt, salt + SALT_SIZE_BYTES, out);
+
+        hidden[0] = static_cast<uint8_t>(size);
+        std::copy(password, password + size, hidden + 1);
+        std::fill(hidden + 1 + size, hidden + hiddenSize, 0);
+
+        HideChain(hidden, hiddenSize, requestAuthenticator, salt);
+    }
+
+    // in holds the salt and the hidden data; returns the password length.
+    size_t RevealTunnelPassword(uint8_t * out, const uint8_t * in, size_t size,
+                                const uint8_t * requestAuthenticator) const
+    {
+        if (size < SALT_SIZE_BYTES + AUTHENTICATOR_SIZE_BYTES ||
+            (size - SALT_SIZE_BYTES) % AUTHENTICATOR_SIZE_BYTES != 0 ||
+            size > SALT_SIZE_BYTES + MAX_HIDDEN_TUNNEL_PASSWORD_SIZE_BYTES)
+        {
+            throw Service::ChaosException("Radius::SharedSecret: invalid hidden tunnel password size");
+        }
+
+        const size_t hiddenSize = size - SALT_SIZE_BYTES;
+
+        std::array<uint8_t, MAX_HIDDEN_TUNNEL_PASSWORD_SIZE_BYTES> plain;
+        RevealChain(plain.data(), in + SALT_SIZE_BYTES, hiddenSize, requestAuthenticator, in);
+
+        const size_t passwordSize = plain[0];
+
+        if (passwordSize + 1 > hiddenSize)
+        {
+            Service::SecureErase(plain.data(), plain.size());
+            throw Service::ChaosException("Radius::SharedSecret: invalid tunnel password length");
+        }
+
+        std::copy(plain.begin() + 1, plain.begin() + 1 + passwordSize, out);
+        Service::SecureErase(plain.data(), plain.size());
+
+        return passwordSize;
+    }
+
+    // MD5(Code + Identifier + Length + authenticator + Attributes + Secret).
+    Authenticator ComputePacketAuthenticator(const uint8_t * packet, size_t size,
+                                             const uint8_t * authenticator) const
+    {
+        Hash::Md5::Md5Hasher hasher;
+        DigestPacket(packet, size, authenticator, NO_MESSAGE_AUTHENTICATOR, &hasher, nullptr);
+
+        return hasher.Finish().GetRawDigest();
+    }
+
+    // Fills in the Message-Authenticator attribute, if present, and, except
+    // for Access-Request and Status-Server whose authenticator is random
+    // and already in place, the Request Authenticator.
+    void SignRequest(uint8_t * packet, size_t size) const
+    {
+        const size_t maOffset = ParsePacketOrThrow(packet, size);
+
+        if (IsRandomAuthenticatorRequest(packet[0]))
+        {
+            FillMessageAuthenticator(packet, size, packet + AUTHENTICATOR_OFFSET, maOffset);
+            return;
+        }
+
+        std::fill_n(packet + AUTHENTICATOR_OFFSET, AUTHENTICATOR_SIZE_BYTES, 0);
+
+        FillMessageAuthenticator(packet, size, ZEROS.data(), maOffset);
+
+        const Authenticator authenticator = ComputePacketAuthenticator(packet, size, ZEROS.data());
+        std::copy(authenticator.begin(), authenticator.end(), packet + AUTHENTICATOR_OFFSET);
+    }
+
+    void SignResponse(uint8_t * packet, size_t size, const uint8_t * requestAuthenticator) const
+    {
+        const size_t maOffset = ParsePacketOrThrow(packet, size);
+
+        FillMessageAuthenticator(packet, size, requestAuthenticator, maOffset);
+
+        const Authenticator authenticator = ComputePacketAuthenticator(packet, size, requestAuthenticator);
+        std::copy(authenticator.begin(), authenticator.end(), packet + AUTHENTICATOR_OFFSET);
+    }
+
+    // Access-Request and Status-Server carry a random authenticator, so only
+    // their Message-Authenticator, if any, can be checked.
+    bool VerifyRequest(const uint8_t * packet, size_t size) const
+    {
+        size_t maOffset;
+
+        if (!ParsePacket(packet, size, maOffset))
+        {
+            return false;
+        }
+
+        if (IsRandomAuthenticatorRequest(packet[0]))
+        {
+            return maOffset == NO_MESSAGE_AUTHENTICATOR ||
+                   Verify(packet, size, packet + AUTHENTICATOR_OFFSET, maOffset, false);
+        }
+
+        return Verify(packet, size, ZEROS.data(), maOffset, true);
+    }
+
+    // Checks the Response Authenticator and, if present, the
+    // Message-Authenticator in a single pass over the packet.
+    bool VerifyResponse(const uint8_t * packet, size_t size, const uint8_t * requestAuthenticator) const
+    {
+        size_t maOffset;
+
+        if (!ParsePacket(packet, size, maOffset))
+        {
+            return false;
+        }
+
+        return Verify(packet, size, requestAuthenticator, maOffset, true);
+    }
+
+private:
+    using MacType = Mac::Hmac::Hmac<Hash::Md5::Md5Hasher>;
+
+    static constexpr size_t NO_MESSAGE_AUTHENTICATOR = 0;
+    static constexpr size_t MESSAGE_AUTHENTICATOR_SIZE_BYTES = 2 + AUTHENTICATOR_SIZE_BYTES;
+
+    static constexpr Authenticator ZEROS = {};
+
+    std::vector<uint8_t, Service::SecureAllocator<uint8_t>> Secret_;
+    Hash::Md5::Md5Hasher SecretHasher_;
+    MacType Mac_;
+
+    static constexpr size_t PadToBlock(size_t size)
+    {
+        return (size + AUTHENTICATOR_SIZE_BYTES - 1) / AUTHENTICATOR_SIZE_BYTES * AUTHENTICATOR_SIZE_BYTES;
+    }
+
+    static bool IsRandomAuthenticatorRequest(uint8_t code)
+    {
+        return code == ACCESS_REQUEST || code == STATUS_SERVER;
+    }
+
+    // b(1) = MD5(S + RA [+ salt]), b(i) = MD5(S + c(i-1)); c(i) = p(i) ^ b(i).
+    Authenticator ChainBlock(const uint8_t * previous, const uint8_t * salt) const
+    {
+        Hash::Md5::Md5Hasher hasher = SecretHasher_;
+        hasher.Update(previous, previous + AUTHENTICATOR_SIZE_BYTES);
+
+        if (salt != nullptr)
+        {
+            hasher.Update(salt, salt + SALT_SIZE_BYTES);
+        }
+
+        return hasher.Finish().GetRawDigest();
+    }
+
+    void HideChain(uint8_t * data, size_t size, const uint8_t * requestAuthenticator, const uint8_t * salt) const
+    {
+        const uint8_t * previous = requestAuthenticator;
+
+        for (size_t offset = 0; offset < size; offset += AUTHENTICATOR_SIZE_BYTES)
+        {
+            Authenticator mask = ChainBlock(previous, offset == 0 ? salt : nullptr);
+
+            for (size_t i = 0; i < AUTHENTICATOR_SIZE_BYTES; ++i)
+            {
+                data[offset + i] ^= mask[i];
+            }
+
+            Service::SecureErase(mask.data(), mask.size());
+            previous = data + offset;
+        }
+    }
+
+    void RevealChain(uint8_t * out, const uint8_t * hidden, size_t size,
+                     const uint8_t * requestAuthenticator, const uint8_t * salt) const
+    {
+        const uint8_t * previous = requestAuthenticator;
+
+        for (size_t offset = 0; offset < size; offset += AUTHENTICATOR_SIZE_BYTES)
+        {
+            Authenticator mask = ChainBlock(previous, offset == 0 ? salt : nullptr);
+
+            for (size_t i = 0; i < AUTHENTICATOR_SIZE_BYTES; ++i)
+            {
+                out[offset + i] = hidden[offset + i] ^ mask[i];
+            }
+
+            Service::SecureErase(mask.data(), mask.size());
+            previous = hidden + offset;
+        }
+    }
+
+    // Checks the header length and the attribute layout; maOffset receives
+    // the offset of the Message-Authenticator attribute or NO_MESSAGE_AUTHENTICATOR.
+    static bool ParsePacket(const uint8_t * packet, size_t size, size_t & maOffset)
+    {
+        maOffset = NO_MESSAGE_AUTHENTICATOR;
+
+        if (size < HEADER_SIZE_BYTES || size > MAX_PACKET_SIZE_BYTES)
+        {
+            return false;
+        }
+
+        if ((static_cast<size_t>(packet[2]) << 8 | packet[3]) != size)
+        {
+            return false;
+        }
+
+        for (size_t offset = HEADER_SIZE_BYTES; offset < size;)
+        {
+            if (size - offset < 2 || packet[offset + 1] < 2 || packet[offset + 1] > size - offset)
+            {
+                return false;
+            }
+
+            if (packet[offset] == MESSAGE_AUTHENTICATOR)
+            {
+                if (packet[offset + 1] != MESSAGE_AUTHENTICATOR_SIZE_BYTES || maOffset != NO_MESSAGE_AUTHENTICATOR)
+                {
+                    return false;
+                }
+
+                maOffset = offset;
+            }
+
+            offset += packet[offset + 1];
+        }
+
+        return true;
+    }
+
+    static size_t ParsePacketOrThrow(const uint8_t * packet, size_t size)
+    {
+        size_t maOffset;
+
+        if (!ParsePacket(packet, size, maOffset))
+        {
+            throw Service::ChaosException("Radius::SharedSecret: malformed packet");
+        }
+
+        return maOffset;
+    }
+
+    // Feeds the packet, with authenticator in place of its authenticator
+    // field, to md5 followed by the secret and to mac with the
+    // Message-Authenticator value zeroed. Either sink may be null.
+    void DigestPacket(const uint8_t * packet, size_t size, const uint8_t * authenticator, size_t maOffset,
+                      Hash::Md5::Md5Hasher * md5, MacType * mac) const
+    {
+        auto feed = [md5, mac](const uint8_t * begin, const uint8_t * end)
+        {
+            if (md5 != nullptr)
+            {
+                md5->Update(begin, end);
+            }
+
+            if (mac != nullptr)
+            {
+                mac->Update(begin, end);
+            }
+        };
+
+        feed(packet, packet + AUTHENTICATOR_OFFSET);
+        feed(authenticator, authenticator + AUTHENTICATOR_SIZE_BYTES);
+
+        if (maOffset == NO_MESSAGE_AUTHENTICATOR)
+        {
+            feed(packet + HEADER_SIZE_BYTES, packet + size);
+        }
+        else
+        {
+            const uint8_t * value = packet + maOffset + 2;
+
+            feed(packet + HEADER_SIZE_BYTES, value);
+
+            if (md5 != nullptr)
+            {
+                md5->Update(value, value + AUTHENTICATOR_SIZE_BYTES);
+            }
+
+            if (mac != nullptr)
+            {
+                mac->Update(ZEROS.begin(), ZEROS.end());
+            }
+
+            feed(value + AUTHENTICATOR_SIZE_BYTES, packet + size);
+        }
+
+        if (md5 != nullptr)
+        {
+            md5->Update(Secret_.begin(), Secret_.end());
+        }
+    }
+
+    void FillMessageAuthenticator(uint8_t * packet, size_t size, const uint8_t * authenticator,
+                                  size_t maOffset) const
+    {
+        if (maOffset == NO_MESSAGE_AUTHENTICATOR)
+        {
+            return;
+        }
+
+        MacType mac = Mac_;
+        DigestPacket(packet, size, authenticator, maOffset, nullptr, &mac);
+
+        const Authenticator value = mac.Finish().GetRawDigest();
+        std::copy(value.begin(), value.end(), packet + maOffset + 2);
+    }
+
+    bool Verify(const uint8_t * packet, size_t size, const uint8_t * authenticator, size_t maOffset,
+                bool checkAuthenticator) const
+    {
+        Hash::Md5::Md5Hasher md5;
+        MacType mac = Mac_;
+
+        const bool checkMessageAuthenticator = maOffset != NO_MESSAGE_AUTHENTICATOR;
+
+        DigestPacket(packet, size, authenticator, maOffset,
+                     checkAuthenticator ? &md5 : nullptr,
+                     checkMessageAuthenticator ? &mac : nullptr);
+
+        bool isValid = true;
+
+        if (checkAuthenticator)
+        {
+            const Authenticator expected = md5.Finish().GetRawDigest();
+            isValid &= Service::ConstantTimeEqual(expected.data(), packet + AUTHENTICATOR_OFFSET, expected.size());
+        }
+
+        if (checkMessageAuthenticator)
+        {
+            const Authenticator expected = mac.Finish().GetRawDigest();
+            isValid &= Service::ConstantTimeEqual(expected.data(), packet + maOffset + 2, expected.size());
+        }
+
+        return isValid;
+    }
+};
+
+} // namespace Chaos::Protocol::Radius
+
+#endif // CHAOS_PROTOCOL_RADIUS_RADIUSCRYPTO_HPP
@@ -0,0 +1,357 @@
+#ifndef CHAOS_PROTOCOL_SNMP_USM_HPP
+#define CHAOS_PROTOCOL_SNMP_USM_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Cipher/Block/Block64.hpp"
+#include "Cipher/Block/Des/DesCrypt.hpp"
+#include "Hash/Hasher.hpp"
+#include "Mac/Hmac.hpp"
+#include "Service/ChaosException.hpp"
+#include "Service/ConstantTime.hpp"
+#include "Service/SeArray.hpp"
+#include "Service/SecureAllocator.hpp"
+#include "Service/SecureErase.hpp"
+
+namespace Chaos::Protocol::Snmp::Inner_
+{
+
+inline constexpr size_t EXPANSION_CHUNK_SIZE_BYTES = 4096;
+
+template<typename HasherImpl>
+using DigestType = decltype(std::declval<typename HasherImpl::HashType &>().GetRawDigest());
+
+} // namespace Chaos::Protocol::Snmp::Inner_
+
+namespace Chaos::Protocol::Snmp
+{
+
+inline constexpr size_t EXPANSION_SIZE_BYTES = 1048576;
+inline constexpr size_t MIN_PASSWORD_SIZE_BYTES = 8;
+inline constexpr size_t AUTH_PARAMS_SIZE_BYTES = 12;
+inline constexpr size_t PRIV_PARAMS_SIZE_BYTES = 8;
+
+struct EngineId
+{
+    const uint8_t * Data_;
+    size_t Size_;
+};
+
+// Feeds the password repeated over EXPANSION_SIZE_BYTES into hasher (RFC 3414
+// A.2) without building the megabyte: short passwords are tiled once into a
+// chunk holding a whole number of copies, long ones are hashed in place.
+template<typename HasherImpl>
+void HashExpandedPassword(HasherImpl & hasher, const uint8_t * password, size_t size)
+{
+    if (size < MIN_PASSWORD_SIZE_BYTES)
+    {
+        throw Service::ChaosException("Snmp: password is too short (8 bytes required)");
+    }
+
+    size_t remaining = EXPANSION_SIZE_BYTES;
+
+    if (size <= Inner_::EXPANSION_CHUNK_SIZE_BYTES)
+    {
+        std::array<uint8_t, Inner_::EXPANSION_CHUNK_SIZE_BYTES> chunk;
+        const size_t period = chunk.size() - chunk.size() % size;
+
+        for (size_t offset = 0; offset < period; offset += size)
+        {
+            std::copy(password, password + size, chunk.data() + offset);
+        }
+
+        for (; remaining >= period; remaining -= period)
+        {
+            hasher.Update(chunk.data(), chunk.data() + period);
+        }
+
+        hasher.Update(chunk.data(), chunk.data() + remaining);
+
+        Service::SecureErase(chunk.data(), chunk.size());
+    }
+    else
+    {
+        while (remaining > 0)
+        {
+            const size_t step = std::min(remaining, size);
+
+            hasher.Update(password, password + step);
+            remaining -= step;
+        }
+    }
+}
+
+// The user's master key Ku. Deriving it from a password costs a megabyte of
+// hashing, so it is computed once per user and localized to every engine
+// from here; localization is a couple of compression function calls.
+template<typename HasherImpl,
+         typename = std::enable_if_t<std::is_base_of_v<Hash::Hasher<HasherImpl>, HasherImpl>>>
+class MasterKey
+{
+public:
+    using LocalizedKey = Inner_::DigestType<HasherImpl>;
+
+    static constexpr size_t KEY_SIZE_BYTES = std::tuple_size_v<LocalizedKey>;
+
+    template<typename InputIt>
+    MasterKey(InputIt keyBegin, InputIt keyEnd)
+    {
+        size_t i = 0;
+        InputIt it = keyBegin;
+        for (; i < Key_.Size() && it != keyEnd; ++i, ++it)
+        {
+            Key_[i] = static_cast<uint8_t>(*it);
+        }
+
+        if (i != Key_.Size() || it != keyEnd)
+        {
+            throw Service::ChaosException("Snmp::MasterKey: invalid key length");
+        }
+    }
+
+    template<typename InputIt>
+    static MasterKey FromPassword(InputIt passwordBegin, InputIt passwordEnd)
+    {
+        const std::vector<uint8_t, Service::SecureAllocator<uint8_t>> password(passwordBegin, passwordEnd);
+
+        HasherImpl hasher;
+        HashExpandedPassword(hasher, password.data(), password.size());
+
+        auto key = hasher.Finish().GetRawDigest();
+        MasterKey result(key.begin(), key.end());
+
+        Service::SecureErase(key.data(), key.size());
+
+        return result;
+    }
+
+    LocalizedKey Localize(const uint8_t * engineId, size_t size) const
+    {
+        HasherImpl hasher;
+
+        hasher.Update(Key_.Begin(), Key_.End());
+        hasher.Update(engineId, engineId + size);
+        hasher.Update(Key_.Begin(), Key_.End());
+
+        return hasher.Finish().GetRawDigest();
+    }
+
+    // Localizes to count engines, splitting the work over threadCount
+    // threads (the calling thread included).
+    void LocalizeMany(const EngineId * engineIds, size_t count, LocalizedKey * results,
+                      size_t threadCount = 1) const
+    {
+        threadCount = std::max<size_t>(1, std::min(threadCount, count));
+
+        auto localizeRange = [this, engineIds, results](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                results[i] = Localize(engineIds[i].Data_, engineIds[i].Size_);
+            }
+        };
+
+        const size_t share = count / threadCount;
+        const size_t extra = count % threadCount;
+
+        std::vector<std::future<void>> workers;
+        workers.reserve(threadCount - 1);
+
+        size_t begin = share + (extra > 0 ? 1 : 0);
+
+        for (size_t t = 1; t < threadCount; ++t)
+        {
+            const size_t end = begin + share + (t < extra ? 1 : 0);
+            workers.push_back(std::async(std::launch::async, localizeRange, begin, end));
+            begin = end;
+        }
+
+        localizeRange(0, share + (extra > 0 ? 1 : 0));
+
+        for (std::future<void> & worker : workers)
+        {
+            worker.get();
+        }
+    }
+
+    const uint8_t * GetRawKey() const
+    {
+        return Key_.Begin();
+    }
+
+private:
+    Service::SeArray<uint8_t, KEY_SIZE_BYTES> Key_;
+};
+
+// HMAC-MD5-96 / HMAC-SHA-96 (RFC 3414 6, 7) over whole messages. The MAC is
+// keyed once with the localized key; msgAuthenticationParameters sits at
+// authParamsOffset and is treated as twelve zero bytes while hashing.
+template<typename HasherImpl,
+         typename = std::enable_if_t<std::is_base_of_v<Hash::Hasher<HasherImpl>, HasherImpl>>>
+class Authenticator
+{
+public:
+    static constexpr size_t KEY_SIZE_BYTES = std::tuple_size_v<Inner_::DigestType<HasherImpl>>;
+
+    template<typename InputIt>
+    Authenticator(InputIt keyBegin, InputIt keyEnd)
+    {
+        if (std::distance(keyBegin, keyEnd) != static_cast<ptrdiff_t>(KEY_SIZE_BYTES))
+        {
+            throw Service::ChaosException("Snmp::Authenticator: invalid key length");
+        }
+
+        Mac_.Rekey(keyBegin, keyEnd);
+    }
+
+    void Sign(uint8_t * message, size_t size, size_t authParamsOffset) const
+    {
+        if (authParamsOffset > size || size - authParamsOffset < AUTH_PARAMS_SIZE_BYTES)
+        {
+            throw Service::ChaosException("Snmp::Authenticator: authentication parameters out of range");
+        }
+
+        const auto mac = Compute(message, size, authParamsOffset);
+        std::copy_n(mac.begin(), AUTH_PARAMS_SIZE_BYTES, message + authParamsOffset);
+    }
+
+    bool Verify(const uint8_t * message, size_t size, size_t authParamsOffset) const
+    {
+        if (authParamsOffset > size || size - authParamsOffset < AUTH_PARAMS_SIZE_BYTES)
+        {
+            return false;
+        }
+
+        const auto mac = Compute(message, size, authParamsOffset);
+
+        return Service::ConstantTimeEqual(mac.data(), message + authParamsOffset, AUTH_PARAMS_SIZE_BYTES);
+    }
+
+private:
+    Mac::Hmac::Hmac<HasherImpl> Mac_;
+
+    Inner_::DigestType<HasherImpl> Compute(const uint8_t * message, size_t size, size_t authParamsOffset) const
+    {
+        static constexpr std::array<uint8_t, AUTH_PARAMS_SIZE_BYTES> ZEROS = {};
+
+        const uint8_t * suffix = message + authParamsOffset + AUTH_PARAMS_SIZE_BYTES;
+
+        Mac::Hmac::Hmac<HasherImpl> mac = Mac_;
+
+        mac.Update(message, message + authParamsOffset);
+        mac.Update(ZEROS.begin(), ZEROS.end());
+        mac.Update(suffix, message + size);
+
+        return mac.Finish().GetRawDigest();
+    }
+};
+
+// CBC-DES privacy (RFC 3414 8): the first eight bytes of the localized key
+// are the DES key, the next eight the pre-IV. Both key schedules are built
+// once per user and engine.
+class DesPrivacy
+{
+public:
+    static constexpr size_t MIN_KEY_SIZE_BYTES = 16;
+    static constexpr size_t BLOCK_SIZE_BYTES = Cipher::Block::Des::DesCrypt::BlockSize;
+
+    template<typename InputIt>
+    DesPrivacy(InputIt keyBegin, InputIt keyEnd)
+        : DesPrivacy(LoadKey(keyBegin, keyEnd))
+    { }
+
+    static constexpr size_t GetEncryptedSize(size_t size)
+    {
+        return (size + BLOCK_SIZE_BYTES - 1) / BLOCK_SIZE_BYTES * BLOCK_SIZE_BYTES;
+    }
+
+    // Writes GetEncryptedSize(size) bytes into out, zero-padding the last
+    // block, and the salt (engineBoots followed by localSalt) into privParams.
+    void Encrypt(uint8_t * out, uint8_t * privParams, const uint8_t * in, size_t size,
+                 uint32_t engineBoots, uint32_t localSalt) const
+    {
+        const uint64_t salt = (static_cast<uint64_t>(engineBoots) << 32) | localSalt;
+        Cipher::Block::Inner_::StoreBlock64(privParams, salt);
+
+        uint64_t chain = PreIv_ ^ salt;
+
+        for (size_t offset = 0; offset < size; offset += BLOCK_SIZE_BYTES)
+        {
+            std::array<uint8_t, BLOCK_SIZE_BYTES> block = {};
+            std::copy(in + offset, in + std::min(size, offset + BLOCK_SIZE_BYTES), block.begin());
+
+            chain = Encryptor_.EncryptBlock(Cipher::Block::Inner_::LoadBlock64(block.data()) ^ chain);
+            Cipher::Block::Inner_::StoreBlock64(out + offset, chain);
+
+            Service::SecureErase(block.data(), block.size());
+        }
+    }
+
+    // size must be a multiple of the DES block size; out receives size bytes
+    // including whatever padding the sender added.
+    void Decrypt(uint8_t * out, const uint8_t * privParams, const uint8_t * in, size_t size) const
+    {
+        if (size % BLOCK_SIZE_BYTES != 0)
+        {
+            throw Service::ChaosException("Snmp::DesPrivacy: ciphertext size is not a multiple of the block size");
+        }
+
+        uint64_t chain = PreIv_ ^ Cipher::Block::Inner_::LoadBlock64(privParams);
+
+        for (size_t offset = 0; offset < size; offset += BLOCK_SIZE_BYTES)
+        {
+            const uint64_t block = Cipher::Block::Inner_::LoadBlock64(in + offset);
+
+            Cipher::Block::Inner_::StoreBlock64(out + offset, Decryptor_.DecryptBlock(block) ^ chain);
+            chain = block;
+        }
+    }
+
+private:
+    using KeyType = std::array<uint8_t, MIN_KEY_SIZE_BYTES>;
+
+    Cipher::Block::Des::DesCrypt::DesEncryptor Encryptor_;
+    Cipher::Block::Des::DesCrypt::DesDecryptor Decryptor_;
+    uint64_t PreIv_;
+
+    explicit DesPrivacy(KeyType key)
+        : Encryptor_(Cipher::Block::Des::DesCrypt::Key(key.begin(), key.begin() + 8)),
+          Decryptor_(Cipher::Block::Des::DesCrypt::Key(key.begin(), key.begin() + 8)),
+          PreIv_(Cipher::Block::Inner_::LoadBlock64(key.data() + 8))
+    {
+        Service::SecureErase(key.data(), key.size());
+    }
+
+    // Localized keys longer than sixteen bytes (SHA-1) are truncated.
+    template<typename InputIt>
+    static KeyType LoadKey(InputIt keyBegin, InputIt keyEnd)
+    {
+        KeyType result;
+
+        size_t i = 0;
+        for (InputIt it = keyBegin; i < result.size() && it != keyEnd; ++i, ++it)
+        {
+            result[i] = static_cast<uint8_t>(*it);
+        }
+
+        if (i != result.size())
+        {
+            throw Service::ChaosException("Snmp::DesPrivacy: invalid key length (16 bytes required)");
+        }
+
+        return result;
+    }
+};
+
+} // namespace Chaos::Protocol::Snmp
+
+#endif // CHAOS_PROTOCOL_SNMP_USM_HPP
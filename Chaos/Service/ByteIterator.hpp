@@ -0,0 +1,87 @@
+#ifndef CHAOS_SERVICE_BYTEITERATOR_HPP
+#define CHAOS_SERVICE_BYTEITERATOR_HPP
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Chaos::Service
+{
+
+namespace Inner_
+{
+
+// Evaluated lazily: output iterators such as std::back_insert_iterator have
+// a void value_type, which must not reach sizeof.
+template<typename T>
+struct IsByteImpl : std::conjunction<std::is_integral<T>,
+                                     std::negation<std::is_same<T, bool>>,
+                                     std::bool_constant<sizeof(T) == 1>>
+{
+};
+
+template<>
+struct IsByteImpl<void> : std::false_type
+{
+};
+
+template<typename T>
+inline constexpr bool IsByte = IsByteImpl<T>::value;
+
+template<typename It, typename = void>
+struct IsContiguousByteIterator : std::false_type
+{
+};
+
+template<typename It>
+struct IsContiguousByteIterator<It, std::enable_if_t<std::is_pointer_v<It>>>
+    : std::bool_constant<IsByte<std::remove_cv_t<std::remove_pointer_t<It>>>>
+{
+};
+
+template<typename It>
+struct IsContiguousByteIterator<It, std::enable_if_t<!std::is_pointer_v<It> &&
+                                                     IsByte<typename std::iterator_traits<It>::value_type>>>
+{
+    using ValueType = typename std::iterator_traits<It>::value_type;
+
+    static constexpr bool value = std::is_same_v<It, typename std::vector<ValueType>::iterator> ||
+                                  std::is_same_v<It, typename std::vector<ValueType>::const_iterator> ||
+                                  std::is_same_v<It, typename std::basic_string<ValueType>::iterator> ||
+                                  std::is_same_v<It, typename std::basic_string<ValueType>::const_iterator>;
+};
+
+template<typename It, typename = void>
+struct IsMutableByteIterator : std::false_type
+{
+};
+
+template<typename It>
+struct IsMutableByteIterator<It, std::enable_if_t<IsContiguousByteIterator<It>::value>>
+    : std::negation<std::is_const<std::remove_reference_t<decltype(*std::declval<It>())>>>
+{
+};
+
+} // namespace Inner_
+
+template<typename It>
+inline constexpr bool IsContiguousByteIterator = Inner_::IsContiguousByteIterator<It>::value;
+
+template<typename It>
+inline constexpr bool IsContiguousMutableByteIterator = Inner_::IsMutableByteIterator<It>::value;
+
+template<typename It>
+auto ToBytePointer(It it)
+{
+    static_assert(IsContiguousByteIterator<It>);
+
+    using Byte = std::conditional_t<std::is_const_v<std::remove_reference_t<decltype(*it)>>, const uint8_t, uint8_t>;
+
+    return reinterpret_cast<Byte *>(&*it);
+}
+
+} // namespace Chaos::Service
+
+#endif // CHAOS_SERVICE_BYTEITERATOR_HPP
@@ -0,0 +1,27 @@
+#ifndef CHAOS_SERVICE_CONSTANTTIME_HPP
+#define CHAOS_SERVICE_CONSTANTTIME_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Chaos::Service
+{
+
+inline bool ConstantTimeEqual(const void * lhs, const void * rhs, size_t size) noexcept
+{
+    const volatile uint8_t * a = static_cast<const volatile uint8_t *>(lhs);
+    const volatile uint8_t * b = static_cast<const volatile uint8_t *>(rhs);
+
+    uint8_t diff = 0;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        diff |= a[i] ^ b[i];
+    }
+
+    return diff == 0;
+}
+
+} // namespace Chaos::Service
+
+#endif // CHAOS_SERVICE_CONSTANTTIME_HPP
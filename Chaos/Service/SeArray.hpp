@@ -1,27 +1,51 @@
 #ifndef CHAOS_SERVICE_SEARRAY_HPP
 #define CHAOS_SERVICE_SEARRAY_HPP
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <type_traits>
 
+#include "Service/SecureErase.hpp"
+
 namespace Chaos::Service
 {
 
-template<typename T, size_t S,
+inline constexpr size_t CACHE_LINE_SIZE = 64;
+
+template<typename T, size_t S, size_t A = alignof(T),
          typename = std::enable_if_t<std::is_integral_v<T>>>
 class SeArray
 {
 public:
+    static_assert(A >= alignof(T), "SeArray: alignment is weaker than the element type requires");
+    static_assert((A & (A - 1)) == 0, "SeArray: alignment must be a power of two");
+
     SeArray()
     {
         Storage_.fill(0);
     }
 
     SeArray(const SeArray & other) = delete;
-    SeArray(SeArray && other) = delete;
+
+    SeArray(SeArray && other) noexcept
+        : Storage_(other.Storage_)
+    {
+        other.EraseImpl();
+    }
 
     SeArray & operator=(const SeArray & other) = delete;
-    SeArray & operator=(SeArray && other) = delete;
+
+    SeArray & operator=(SeArray && other) noexcept
+    {
+        if (this != &other)
+        {
+            Storage_ = other.Storage_;
+            other.EraseImpl();
+        }
+
+        return *this;
+    }
 
     ~SeArray()
     {
@@ -73,20 +97,41 @@ public:
         return S;
     }
 
+    static constexpr size_t Alignment() noexcept
+    {
+        return A;
+    }
+
 private:
-    std::array<T, S> Storage_;
+    alignas(A) std::array<T, S> Storage_;
 
-    void EraseImpl()
+    void EraseImpl() noexcept
     {
-        volatile T * ptr = Storage_.data();
-
-        for (size_t i = 0; i < Storage_.size(); ++i)
-        {
-            *ptr++ = 0;
-        }
+        SecureErase(Storage_.data(), sizeof(Storage_));
     }
 };
 
+template<typename T, size_t S>
+using CacheAlignedSeArray = SeArray<T, S, CACHE_LINE_SIZE>;
+
+// Alignment of the size class of a sizeBytes-byte array: the smallest power
+// of two holding it, capped at a cache line. Arrays of up to a cache line
+// then never straddle two lines, and larger ones start on a line boundary.
+constexpr size_t SizeClassAlignment(size_t sizeBytes)
+{
+    size_t result = 1;
+
+    while (result < sizeBytes && result < CACHE_LINE_SIZE)
+    {
+        result *= 2;
+    }
+
+    return result;
+}
+
+template<typename T, size_t S>
+using SizeClassSeArray = SeArray<T, S, std::max(alignof(T), SizeClassAlignment(sizeof(T) * S))>;
+
 } // namespace Chaos::Service
 
 #endif // CHAOS_SERVICE_SEARRAY_HPP
@@ -0,0 +1,237 @@
+#ifndef CHAOS_SERVICE_SECUREALLOCATOR_HPP
+#define CHAOS_SERVICE_SECUREALLOCATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <memory>
+#include <new>
+#include <shared_mutex>
+#include <vector>
+
+#include "Service/SeArray.hpp"
+#include "Service/SecureArena.hpp"
+
+namespace Chaos::Service
+{
+
+// Power-of-two size classes of SecureArena blocks, plus one arena per
+// allocation above MAX_BLOCK_SIZE. Size-class arenas are never unmapped
+// while the pool lives, so its footprint is its high-water mark. Arenas are
+// indexed by address, so a free finds its arena in logarithmic time under a
+// shared lock and then only takes that arena's own mutex.
+class SecurePool
+{
+public:
+    static constexpr size_t MIN_BLOCK_SIZE = CACHE_LINE_SIZE;
+    static constexpr size_t MAX_BLOCK_SIZE = 4096;
+    static constexpr size_t ARENA_SIZE = 16384;
+
+    explicit SecurePool(LockPolicy lockPolicy = LockPolicy::Require)
+        : LockPolicy_(lockPolicy)
+    { }
+
+    SecurePool(const SecurePool & other) = delete;
+    SecurePool(SecurePool && other) = delete;
+
+    SecurePool & operator=(const SecurePool & other) = delete;
+    SecurePool & operator=(SecurePool && other) = delete;
+
+    static SecurePool & Default()
+    {
+        static SecurePool pool;
+        return pool;
+    }
+
+    void * Allocate(size_t size)
+    {
+        if (size > MAX_BLOCK_SIZE)
+        {
+            auto arena = std::make_unique<SecureArena>(size, 1, LockPolicy_);
+            void * ptr = arena->Allocate();
+
+            std::unique_lock<std::shared_mutex> lock(Mutex_);
+            Oversized_.emplace(arena->Begin(), std::move(arena));
+
+            return ptr;
+        }
+
+        const size_t sizeClass = SizeClass(size);
+
+        {
+            std::shared_lock<std::shared_mutex> lock(Mutex_);
+
+            if (void * ptr = AllocateFromArenas(sizeClass))
+            {
+                return ptr;
+            }
+        }
+
+        std::unique_lock<std::shared_mutex> lock(Mutex_);
+
+        if (void * ptr = AllocateFromArenas(sizeClass))
+        {
+            return ptr;
+        }
+
+        const size_t blockSize = MIN_BLOCK_SIZE << sizeClass;
+        auto arena = std::make_unique<SecureArena>(blockSize, ARENA_SIZE / blockSize, LockPolicy_);
+
+        std::vector<std::unique_ptr<SecureArena>> & arenas = Arenas_[sizeClass];
+        arenas.reserve(arenas.size() + 1);
+
+        ByAddress_.emplace(arena->Begin(), arena.get());
+        arenas.push_back(std::move(arena));
+
+        return arenas.back()->Allocate();
+    }
+
+    // Aborts on a pointer that the pool did not hand out for this size.
+    void Deallocate(void * ptr, size_t size) noexcept
+    {
+        if (size > MAX_BLOCK_SIZE)
+        {
+            std::unique_lock<std::shared_mutex> lock(Mutex_);
+
+            const auto it = FindOwner(Oversized_, ptr);
+
+            if (it != Oversized_.end() && it->second->Begin() == ptr && it->second->BlockSize() >= size)
+            {
+                Oversized_.erase(it);
+                return;
+            }
+        }
+        else
+        {
+            std::shared_lock<std::shared_mutex> lock(Mutex_);
+
+            const auto it = FindOwner(ByAddress_, ptr);
+
+            if (it != ByAddress_.end() && it->second->BlockSize() == (MIN_BLOCK_SIZE << SizeClass(size)))
+            {
+                it->second->Deallocate(ptr);
+                return;
+            }
+        }
+
+        Inner_::AbortOnMisuse("SecurePool: pointer does not belong to the pool");
+    }
+
+private:
+    static constexpr size_t SIZE_CLASS_COUNT = 7;
+
+    static_assert((MIN_BLOCK_SIZE << (SIZE_CLASS_COUNT - 1)) == MAX_BLOCK_SIZE);
+
+    LockPolicy LockPolicy_;
+
+    std::shared_mutex Mutex_;
+    std::array<std::vector<std::unique_ptr<SecureArena>>, SIZE_CLASS_COUNT> Arenas_;
+    std::map<const uint8_t *, SecureArena *> ByAddress_;
+    std::map<const uint8_t *, std::unique_ptr<SecureArena>> Oversized_;
+
+    // Newest arenas first, as they are the likeliest to have free blocks.
+    void * AllocateFromArenas(size_t sizeClass)
+    {
+        const std::vector<std::unique_ptr<SecureArena>> & arenas = Arenas_[sizeClass];
+
+        for (auto it = arenas.rbegin(); it != arenas.rend(); ++it)
+        {
+            if (void * ptr = (*it)->Allocate())
+            {
+                return ptr;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // The arena of arenas whose range contains ptr, or arenas.end().
+    template<typename ArenaMap>
+    static typename ArenaMap::iterator FindOwner(ArenaMap & arenas, const void * ptr) noexcept
+    {
+        auto it = arenas.upper_bound(static_cast<const uint8_t *>(ptr));
+
+        if (it == arenas.begin())
+        {
+            return arenas.end();
+        }
+
+        --it;
+
+        return it->second->Owns(ptr) ? it : arenas.end();
+    }
+
+    static size_t SizeClass(size_t size)
+    {
+        size_t sizeClass = 0;
+
+        while ((MIN_BLOCK_SIZE << sizeClass) < size)
+        {
+            ++sizeClass;
+        }
+
+        return sizeClass;
+    }
+};
+
+template<typename T>
+class SecureAllocator
+{
+public:
+    using value_type = T;
+
+    static_assert(alignof(T) <= CACHE_LINE_SIZE);
+
+    SecureAllocator() noexcept
+        : Pool_(&SecurePool::Default())
+    { }
+
+    explicit SecureAllocator(SecurePool & pool) noexcept
+        : Pool_(&pool)
+    { }
+
+    template<typename U>
+    SecureAllocator(const SecureAllocator<U> & other) noexcept
+        : Pool_(&other.GetPool())
+    { }
+
+    T * allocate(size_t n)
+    {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T))
+        {
+            throw std::bad_alloc();
+        }
+
+        return static_cast<T *>(Pool_->Allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T * ptr, size_t n) noexcept
+    {
+        Pool_->Deallocate(ptr, n * sizeof(T));
+    }
+
+    SecurePool & GetPool() const noexcept
+    {
+        return *Pool_;
+    }
+
+    template<typename U>
+    bool operator==(const SecureAllocator<U> & other) const noexcept
+    {
+        return Pool_ == &other.GetPool();
+    }
+
+    template<typename U>
+    bool operator!=(const SecureAllocator<U> & other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+private:
+    SecurePool * Pool_;
+};
+
+} // namespace Chaos::Service
+
+#endif // CHAOS_SERVICE_SECUREALLOCATOR_HPP
@@ -0,0 +1,246 @@
+#ifndef CHAOS_SERVICE_SECUREARENA_HPP
+#define CHAOS_SERVICE_SECUREARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "Service/ChaosException.hpp"
+#include "Service/SeArray.hpp"
+#include "Service/SecureErase.hpp"
+
+namespace Chaos::Service::Inner_
+{
+
+// Freeing memory that was never handed out, or freeing it twice, would let
+// two owners share one block of key material. It cannot be reported by an
+// exception from a deallocation path, so the process is stopped instead.
+[[noreturn]] inline void AbortOnMisuse(const char * message) noexcept
+{
+    std::fputs(message, stderr);
+    std::fputc('\n', stderr);
+    std::abort();
+}
+
+} // namespace Chaos::Service::Inner_
+
+namespace Chaos::Service
+{
+
+// Whether an arena that cannot be locked into RAM (mlock failed, usually
+// because of RLIMIT_MEMLOCK) is an error or is used swappable.
+enum class LockPolicy
+{
+    Require,
+    BestEffort
+};
+
+// Fixed-size blocks in one mapping that is locked into RAM, excluded from
+// core dumps and wiped block by block on free. Limits:
+// - guard pages sit only before the first and after the last block, so an
+//   overrun from one block into its neighbour is not caught;
+// - the mapping lives as long as the arena; a SecurePool keeps its
+//   size-class arenas until the pool itself is destroyed.
+class SecureArena
+{
+public:
+    SecureArena(size_t blockSize, size_t blockCount, LockPolicy lockPolicy = LockPolicy::Require)
+    {
+        if (blockSize == 0 || blockCount == 0)
+        {
+            throw ChaosException("SecureArena: block size and block count must be positive");
+        }
+
+        PageSize_ = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        BlockSize_ = RoundUp(blockSize, CACHE_LINE_SIZE);
+        BlockCount_ = blockCount;
+        DataSize_ = RoundUp(BlockSize_ * BlockCount_, PageSize_);
+        MappingSize_ = DataSize_ + 2 * PageSize_;
+
+        void * mapping = mmap(nullptr, MappingSize_, PROT_NONE,
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (mapping == MAP_FAILED)
+        {
+            throw ChaosException("SecureArena: failed to map arena memory");
+        }
+
+        Mapping_ = static_cast<uint8_t *>(mapping);
+        Data_ = Mapping_ + PageSize_;
+
+        if (mprotect(Data_, DataSize_, PROT_READ | PROT_WRITE) != 0)
+        {
+            munmap(Mapping_, MappingSize_);
+            throw ChaosException("SecureArena: failed to unprotect arena memory");
+        }
+
+        IsLocked_ = mlock(Data_, DataSize_) == 0;
+
+        if (!IsLocked_ && lockPolicy == LockPolicy::Require)
+        {
+            munmap(Mapping_, MappingSize_);
+            throw ChaosException("SecureArena: failed to lock arena memory (check RLIMIT_MEMLOCK "
+                                 "or use LockPolicy::BestEffort)");
+        }
+
+#ifdef MADV_DONTDUMP
+        madvise(Data_, DataSize_, MADV_DONTDUMP);
+#endif
+
+        FreeList_.reserve(BlockCount_);
+        FreeBits_.assign((BlockCount_ + 63) / 64, 0);
+
+        for (size_t idx = BlockCount_; idx > 0; --idx)
+        {
+            FreeList_.push_back(idx - 1);
+            SetFree(idx - 1, true);
+        }
+    }
+
+    SecureArena(const SecureArena & other) = delete;
+    SecureArena(SecureArena && other) = delete;
+
+    SecureArena & operator=(const SecureArena & other) = delete;
+    SecureArena & operator=(SecureArena && other) = delete;
+
+    ~SecureArena()
+    {
+        SecureErase(Data_, DataSize_);
+
+        if (IsLocked_)
+        {
+            munlock(Data_, DataSize_);
+        }
+
+        munmap(Mapping_, MappingSize_);
+    }
+
+    void * Allocate()
+    {
+        std::lock_guard<std::mutex> lock(Mutex_);
+
+        if (FreeList_.empty())
+        {
+            return nullptr;
+        }
+
+        size_t idx = FreeList_.back();
+        FreeList_.pop_back();
+        SetFree(idx, false);
+
+        return Data_ + idx * BlockSize_;
+    }
+
+    // Aborts on a pointer that is not an allocated block of this arena,
+    // including one that was already freed.
+    void Deallocate(void * ptr) noexcept
+    {
+        if (!Owns(ptr))
+        {
+            Inner_::AbortOnMisuse("SecureArena: pointer does not belong to the arena");
+        }
+
+        size_t offset = static_cast<uint8_t *>(ptr) - Data_;
+
+        if (offset % BlockSize_ != 0)
+        {
+            Inner_::AbortOnMisuse("SecureArena: pointer is not a block start");
+        }
+
+        const size_t idx = offset / BlockSize_;
+
+        std::lock_guard<std::mutex> lock(Mutex_);
+
+        if (IsFree(idx))
+        {
+            Inner_::AbortOnMisuse("SecureArena: block is already free");
+        }
+
+        SecureErase(ptr, BlockSize_);
+
+        SetFree(idx, true);
+        FreeList_.push_back(idx);
+    }
+
+    const uint8_t * Begin() const noexcept
+    {
+        return Data_;
+    }
+
+    bool Owns(const void * ptr) const noexcept
+    {
+        const uint8_t * bytePtr = static_cast<const uint8_t *>(ptr);
+
+        return bytePtr >= Data_ && bytePtr < Data_ + BlockSize_ * BlockCount_;
+    }
+
+    size_t BlockSize() const noexcept
+    {
+        return BlockSize_;
+    }
+
+    size_t BlockCount() const noexcept
+    {
+        return BlockCount_;
+    }
+
+    size_t FreeBlockCount() const
+    {
+        std::lock_guard<std::mutex> lock(Mutex_);
+        return FreeList_.size();
+    }
+
+    bool IsLocked() const noexcept
+    {
+        return IsLocked_;
+    }
+
+private:
+    size_t PageSize_;
+    size_t BlockSize_;
+    size_t BlockCount_;
+    size_t DataSize_;
+    size_t MappingSize_;
+
+    uint8_t * Mapping_;
+    uint8_t * Data_;
+    bool IsLocked_;
+
+    mutable std::mutex Mutex_;
+    std::vector<size_t> FreeList_;
+    std::vector<uint64_t> FreeBits_;
+
+    bool IsFree(size_t idx) const noexcept
+    {
+        return (FreeBits_[idx / 64] >> (idx % 64)) & 0b1;
+    }
+
+    void SetFree(size_t idx, bool isFree) noexcept
+    {
+        const uint64_t bit = static_cast<uint64_t>(0b1) << (idx % 64);
+
+        if (isFree)
+        {
+            FreeBits_[idx / 64] |= bit;
+        }
+        else
+        {
+            FreeBits_[idx / 64] &= ~bit;
+        }
+    }
+
+    static size_t RoundUp(size_t value, size_t multiple)
+    {
+        return ((value + multiple - 1) / multiple) * multiple;
+    }
+};
+
+} // namespace Chaos::Service
+
+#endif // CHAOS_SERVICE_SECUREARENA_HPP
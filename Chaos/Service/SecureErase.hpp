@@ -0,0 +1,37 @@
+#ifndef CHAOS_SERVICE_SECUREERASE_HPP
+#define CHAOS_SERVICE_SECUREERASE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Chaos::Service
+{
+
+inline void SecureErase(void * ptr, size_t size) noexcept
+{
+    if (ptr == nullptr || size == 0)
+    {
+        return;
+    }
+
+#if defined(__GNUC__) || defined(__clang__)
+    std::memset(ptr, 0, size);
+
+    // The empty asm statement takes the pointer as an input and clobbers
+    // memory, so the compiler has to assume the zeroed bytes are read
+    // and cannot drop the memset as a dead store.
+    __asm__ __volatile__("" : : "r"(ptr) : "memory");
+#else
+    volatile uint8_t * bytes = static_cast<volatile uint8_t *>(ptr);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        bytes[i] = 0;
+    }
+#endif
+}
+
+} // namespace Chaos::Service
+
+#endif // CHAOS_SERVICE_SECUREERASE_HPP
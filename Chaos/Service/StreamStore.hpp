@@ -0,0 +1,46 @@
+#ifndef CHAOS_SERVICE_STREAMSTORE_HPP
+#define CHAOS_SERVICE_STREAMSTORE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace Chaos::Service
+{
+
+inline constexpr size_t NON_TEMPORAL_THRESHOLD = 256 * 1024;
+
+inline void StreamStore(void * dst, const void * src, size_t size) noexcept
+{
+#ifdef __SSE2__
+    if (reinterpret_cast<uintptr_t>(dst) % 16 == 0 && size % 16 == 0)
+    {
+        __m128i * out = static_cast<__m128i *>(dst);
+        const __m128i * in = static_cast<const __m128i *>(src);
+
+        for (size_t i = 0; i < size / 16; ++i)
+        {
+            _mm_stream_si128(out + i, _mm_loadu_si128(in + i));
+        }
+
+        return;
+    }
+#endif
+
+    std::memcpy(dst, src, size);
+}
+
+inline void StreamFence() noexcept
+{
+#ifdef __SSE2__
+    _mm_sfence();
+#endif
+}
+
+} // namespace Chaos::Service
+
+#endif // CHAOS_SERVICE_STREAMSTORE_HPP
@@ -0,0 +1,200 @@
+#ifndef CHAOS_SERVICE_UTF8_HPP
+#define CHAOS_SERVICE_UTF8_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include "Service/ByteIterator.hpp"
+#include "Service/ChaosException.hpp"
+#include "Service/SecureErase.hpp"
+
+namespace Chaos::Service::Inner_
+{
+
+template<typename InputIt>
+uint32_t DecodeUtf8CodePoint(InputIt & it, InputIt end)
+{
+    const uint8_t lead = static_cast<uint8_t>(*it++);
+
+    if (lead < 0x80)
+    {
+        return lead;
+    }
+
+    int_fast8_t tailSize;
+    uint32_t codePoint;
+    uint32_t minCodePoint;
+
+    if ((lead & 0xe0) == 0xc0)
+    {
+        tailSize = 1;
+        codePoint = lead & 0x1f;
+        minCodePoint = 0x80;
+    }
+    else if ((lead & 0xf0) == 0xe0)
+    {
+        tailSize = 2;
+        codePoint = lead & 0x0f;
+        minCodePoint = 0x800;
+    }
+    else if ((lead & 0xf8) == 0xf0)
+    {
+        tailSize = 3;
+        codePoint = lead & 0x07;
+        minCodePoint = 0x10000;
+    }
+    else
+    {
+        throw ChaosException("Utf8ToUtf16Le: invalid UTF-8 lead byte");
+    }
+
+    for (; tailSize > 0; --tailSize)
+    {
+        if (it == end)
+        {
+            throw ChaosException("Utf8ToUtf16Le: truncated UTF-8 sequence");
+        }
+
+        const uint8_t tail = static_cast<uint8_t>(*it++);
+
+        if ((tail & 0xc0) != 0x80)
+        {
+            throw ChaosException("Utf8ToUtf16Le: invalid UTF-8 continuation byte");
+        }
+
+        codePoint = (codePoint << 6) | (tail & 0x3f);
+    }
+
+    if (codePoint < minCodePoint || codePoint > 0x10ffff || (codePoint >= 0xd800 && codePoint <= 0xdfff))
+    {
+        throw ChaosException("Utf8ToUtf16Le: invalid UTF-8 code point");
+    }
+
+    return codePoint;
+}
+
+} // namespace Chaos::Service::Inner_
+
+namespace Chaos::Service
+{
+
+inline constexpr size_t UTF16_CHUNK_SIZE_BYTES = 128;
+
+struct IdentityCodePoint
+{
+    constexpr uint32_t operator()(uint32_t codePoint) const
+    {
+        return codePoint;
+    }
+};
+
+// Transcodes UTF-8 into UTF-16LE and hands the result to sink(const uint8_t *, size_t)
+// in chunks of at most UTF16_CHUNK_SIZE_BYTES, so no intermediate string is built.
+// Every code point goes through transform first; ASCII must stay within the BMP.
+// Contiguous input is scanned eight bytes at a time while it stays ASCII.
+template<typename InputIt, typename Sink, typename Transform>
+void Utf8ToUtf16Le(InputIt begin, InputIt end, Sink && sink, Transform && transform)
+{
+    std::array<uint8_t, UTF16_CHUNK_SIZE_BYTES> chunk;
+    size_t chunkSize = 0;
+
+    auto flush = [&chunk, &chunkSize, &sink]()
+    {
+        sink(chunk.data(), chunkSize);
+        chunkSize = 0;
+    };
+
+    auto put = [&chunk, &chunkSize, &flush](uint16_t unit)
+    {
+        chunk[chunkSize++] = static_cast<uint8_t>(unit);
+        chunk[chunkSize++] = static_cast<uint8_t>(unit >> 8);
+
+        if (chunkSize == chunk.size())
+        {
+            flush();
+        }
+    };
+
+    InputIt it = begin;
+
+    while (it != end)
+    {
+        if constexpr (IsContiguousByteIterator<InputIt>)
+        {
+            const uint8_t * bytes = ToBytePointer(it);
+            size_t remaining = static_cast<size_t>(end - it);
+
+            while (remaining >= sizeof(uint64_t))
+            {
+                uint64_t word;
+                std::memcpy(&word, bytes, sizeof(word));
+
+                if ((word & 0x8080808080808080) != 0)
+                {
+                    break;
+                }
+
+                if (chunkSize + 2 * sizeof(uint64_t) > chunk.size())
+                {
+                    flush();
+                }
+
+                for (size_t i = 0; i < sizeof(uint64_t); ++i)
+                {
+                    const uint16_t unit = static_cast<uint16_t>(transform(bytes[i]));
+
+                    chunk[chunkSize + 2 * i] = static_cast<uint8_t>(unit);
+                    chunk[chunkSize + 2 * i + 1] = static_cast<uint8_t>(unit >> 8);
+                }
+
+                chunkSize += 2 * sizeof(uint64_t);
+
+                if (chunkSize == chunk.size())
+                {
+                    flush();
+                }
+
+                bytes += sizeof(uint64_t);
+                it += sizeof(uint64_t);
+                remaining -= sizeof(uint64_t);
+            }
+
+            if (it == end)
+            {
+                break;
+            }
+        }
+
+        const uint32_t codePoint = transform(Inner_::DecodeUtf8CodePoint(it, end));
+
+        if (codePoint < 0x10000)
+        {
+            put(static_cast<uint16_t>(codePoint));
+        }
+        else
+        {
+            put(static_cast<uint16_t>(0xd800 | ((codePoint - 0x10000) >> 10)));
+            put(static_cast<uint16_t>(0xdc00 | ((codePoint - 0x10000) & 0x3ff)));
+        }
+    }
+
+    if (chunkSize > 0)
+    {
+        flush();
+    }
+
+    SecureErase(chunk.data(), chunk.size());
+}
+
+template<typename InputIt, typename Sink>
+void Utf8ToUtf16Le(InputIt begin, InputIt end, Sink && sink)
+{
+    Utf8ToUtf16Le(begin, end, std::forward<Sink>(sink), IdentityCodePoint());
+}
+
+} // namespace Chaos::Service
+
+#endif // CHAOS_SERVICE_UTF8_HPP
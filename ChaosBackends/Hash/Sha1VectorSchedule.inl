@@ -0,0 +1,109 @@
+#ifndef CHAOS_BACKENDS_HASH_SHA1VECTORSCHEDULE_INL
+#define CHAOS_BACKENDS_HASH_SHA1VECTORSCHEDULE_INL
+
+#include <cstdint>
+#include <immintrin.h>
+
+namespace
+{
+
+__m128i Rotl1(__m128i v)
+{
+    return _mm_or_si128(_mm_slli_epi32(v, 1), _mm_srli_epi32(v, 31));
+}
+
+uint32_t Rotl(uint32_t v, int s)
+{
+    return (v << s) | (v >> (32 - s));
+}
+
+template<int G>
+__m128i ScheduleGroup(__m128i (&w)[4])
+{
+    if constexpr (G >= 4)
+    {
+        __m128i x = _mm_xor_si128(_mm_srli_si128(w[(G - 1) & 3], 4), w[(G - 2) & 3]);
+        x = _mm_xor_si128(x, _mm_alignr_epi8(w[(G - 3) & 3], w[G & 3], 8));
+        x = _mm_xor_si128(x, w[G & 3]);
+        x = Rotl1(x);
+
+        w[G & 3] = _mm_xor_si128(x, Rotl1(_mm_slli_si128(x, 12)));
+    }
+
+    return _mm_add_epi32(w[G & 3], _mm_set1_epi32(G < 5  ? 0x5a827999 :
+                                                  G < 10 ? 0x6ed9eba1 :
+                                                  G < 15 ? 0x8f1bbcdc : 0xca62c1d6));
+}
+
+template<int T>
+void Round(uint32_t a, uint32_t & b, uint32_t c, uint32_t d, uint32_t & e, const uint32_t * wk)
+{
+    uint32_t f;
+
+    if constexpr (T < 20)
+    {
+        f = d ^ (b & (c ^ d));
+    }
+    else if constexpr (T < 40 || T >= 60)
+    {
+        f = b ^ c ^ d;
+    }
+    else
+    {
+        f = (b & c) | (d & (b | c));
+    }
+
+    e += Rotl(a, 5) + f + wk[T & 3];
+    b = Rotl(b, 30);
+}
+
+template<int T>
+void Rounds(uint32_t & a, uint32_t & b, uint32_t & c, uint32_t & d, uint32_t & e,
+            __m128i (&w)[4], __m128i wkNext)
+{
+    if constexpr (T < 80)
+    {
+        alignas(16) uint32_t wk[4];
+        _mm_store_si128(reinterpret_cast<__m128i *>(wk), wkNext);
+
+        if constexpr (T + 4 < 80)
+        {
+            wkNext = ScheduleGroup<T / 4 + 1>(w);
+        }
+
+        Round<T + 0>(a, b, c, d, e, wk);
+        Round<T + 1>(e, a, b, c, d, wk);
+        Round<T + 2>(d, e, a, b, c, wk);
+        Round<T + 3>(c, d, e, a, b, wk);
+
+        Rounds<T + 4>(b, c, d, e, a, w, wkNext);
+    }
+}
+
+void UpdateBufferVectorSchedule(uint32_t * regs, const uint32_t * words)
+{
+    __m128i w[4];
+
+    for (int i = 0; i < 4; ++i)
+    {
+        w[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(words + i * 4));
+    }
+
+    uint32_t a = regs[0];
+    uint32_t b = regs[1];
+    uint32_t c = regs[2];
+    uint32_t d = regs[3];
+    uint32_t e = regs[4];
+
+    Rounds<0>(a, b, c, d, e, w, ScheduleGroup<0>(w));
+
+    regs[0] += a;
+    regs[1] += b;
+    regs[2] += c;
+    regs[3] += d;
+    regs[4] += e;
+}
+
+} // namespace
+
+#endif // CHAOS_BACKENDS_HASH_SHA1VECTORSCHEDULE_INL
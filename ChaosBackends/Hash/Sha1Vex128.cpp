@@ -0,0 +1,16 @@
+#include <cstdint>
+
+#include "Sha1VectorSchedule.inl"
+
+namespace Chaos::Hash::Sha1::Inner_
+{
+
+// The message schedule runs four words per 128-bit register; built for the
+// AVX2 level, so the vector code is VEX-encoded and the scalar rounds
+// rotate with BMI2's rorx.
+void UpdateBufferVex128(uint32_t * regs, const uint32_t * words)
+{
+    UpdateBufferVectorSchedule(regs, words);
+}
+
+} // namespace Chaos::Hash::Sha1::Inner_
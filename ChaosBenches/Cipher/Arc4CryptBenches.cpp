@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <vector>
+
+#include "Cipher/Arc4/Arc4Crypt.hpp"
+
+using namespace Chaos::Cipher::Arc4;
+
+static const char * KEY_BEGIN = "Niccolo01234567";
+static const size_t KEY_LEN = strlen(KEY_BEGIN);
+static const char * KEY_END = KEY_BEGIN + KEY_LEN;
+
+static void Arc4Crypt_EncryptThroughputBench(benchmark::State & state)
+{
+    std::vector<uint8_t> in(state.range(0), 0x5a);
+    std::vector<uint8_t> out(state.range(0));
+
+    Arc4Crypt arc4(KEY_BEGIN, KEY_END);
+
+    for (auto _ : state)
+    {
+        arc4.Encrypt(out.begin(), in.begin(), in.size());
+
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Arc4Crypt_EncryptThroughputBench)->RangeMultiplier(8)->Range(16, 64 << 20);
+
+static void Arc4Crypt_DecryptThroughputBench(benchmark::State & state)
+{
+    std::vector<uint8_t> in(state.range(0), 0x5a);
+    std::vector<uint8_t> out(state.range(0));
+
+    Arc4Crypt arc4(KEY_BEGIN, KEY_END);
+
+    for (auto _ : state)
+    {
+        arc4.Decrypt(out.begin(), in.begin(), in.size());
+
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Arc4Crypt_DecryptThroughputBench)->RangeMultiplier(8)->Range(16, 64 << 20);
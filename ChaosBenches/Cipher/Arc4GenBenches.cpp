@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <vector>
+
+#include "Cipher/Arc4/Arc4Gen.hpp"
+
+using namespace Chaos::Cipher::Arc4;
+
+static const char * KEY_BEGIN = "Niccolo01234567";
+static const size_t KEY_LEN = strlen(KEY_BEGIN);
+static const char * KEY_END = KEY_BEGIN + KEY_LEN;
+
+static void Arc4Gen_RekeyBench(benchmark::State & state)
+{
+    Arc4Gen gen;
+
+    for (auto _ : state)
+    {
+        gen.Rekey(KEY_BEGIN, KEY_END);
+
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK(Arc4Gen_RekeyBench);
+
+static void Arc4Gen_ThroughputBench(benchmark::State & state)
+{
+    std::vector<uint8_t> out(state.range(0));
+
+    Arc4Gen gen(KEY_BEGIN, KEY_END);
+
+    for (auto _ : state)
+    {
+        gen.Generate(out.begin(), out.size());
+
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Arc4Gen_ThroughputBench)->RangeMultiplier(8)->Range(16, 64 << 20);
@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <string>
+#include <vector>
+
+#include <Cipher/Block/CbcHmac.hpp>
+#include <Cipher/Block/Des/DesCrypt.hpp>
+#include <Cipher/Block/Des/Des3Crypt.hpp>
+#include <Hash/Sha1.hpp>
+#include <Mac/Hmac.hpp>
+
+using namespace Chaos::Cipher::Block;
+using namespace Chaos::Cipher::Block::Des;
+using namespace Chaos::Hash::Sha1;
+using namespace Chaos::Mac::Hmac;
+
+static const std::array<uint8_t, 24> KEY = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+                                             0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01,
+                                             0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01, 0x23 };
+static const std::string MAC_KEY = "0123456789abcdef0123";
+
+static void DesCbcHmacSha1_SequentialBench(benchmark::State & state)
+{
+    std::vector<uint8_t> in(state.range(0), 0x5a);
+    std::vector<uint8_t> out(state.range(0));
+
+    DesCrypt::Key key(KEY.begin(), KEY.begin() + 8);
+    DesCrypt::DesEncryptor enc(key);
+
+    for (auto _ : state)
+    {
+        uint64_t chain = 0;
+
+        for (size_t i = 0; i < in.size(); i += 8)
+        {
+            chain = enc.EncryptBlock(Chaos::Cipher::Block::Inner_::LoadBlock64(in.data() + i) ^ chain);
+            Chaos::Cipher::Block::Inner_::StoreBlock64(out.data() + i, chain);
+        }
+
+        Hmac<Sha1Hasher> hmac(MAC_KEY.begin(), MAC_KEY.end());
+        hmac.Update(out.begin(), out.end());
+
+        benchmark::DoNotOptimize(hmac.Finish());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(DesCbcHmacSha1_SequentialBench)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+static void DesCbcHmacSha1_StitchedBench(benchmark::State & state)
+{
+    std::vector<uint8_t> in(state.range(0), 0x5a);
+    std::vector<uint8_t> out(state.range(0));
+
+    DesCrypt::Key key(KEY.begin(), KEY.begin() + 8);
+    CbcHmacEncryptor<DesCrypt::DesEncryptor, Sha1Hasher> enc(key, MAC_KEY.begin(), MAC_KEY.end());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(enc.Encrypt(out.data(), in.data(), in.size(), 0));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(DesCbcHmacSha1_StitchedBench)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+static void Des3CbcHmacSha1_StitchedBench(benchmark::State & state)
+{
+    std::vector<uint8_t> in(state.range(0), 0x5a);
+    std::vector<uint8_t> out(state.range(0));
+
+    Des3Crypt::Key key(KEY.begin(), KEY.end());
+    CbcHmacEncryptor<Des3Crypt::Des3Encryptor, Sha1Hasher> enc(key, MAC_KEY.begin(), MAC_KEY.end());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(enc.Encrypt(out.data(), in.data(), in.size(), 0));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Des3CbcHmacSha1_StitchedBench)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+static void Des3CbcHmacSha1_VerifyDecryptBench(benchmark::State & state)
+{
+    std::vector<uint8_t> in(state.range(0), 0x5a);
+    std::vector<uint8_t> out(state.range(0));
+
+    Des3Crypt::Key key(KEY.begin(), KEY.end());
+    CbcHmacEncryptor<Des3Crypt::Des3Encryptor, Sha1Hasher> enc(key, MAC_KEY.begin(), MAC_KEY.end());
+    CbcHmacDecryptor<Des3Crypt::Des3Decryptor, Sha1Hasher> dec(key, MAC_KEY.begin(), MAC_KEY.end());
+
+    auto tag = enc.Encrypt(in.data(), in.data(), in.size(), 0);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(dec.Decrypt(out.data(), in.data(), in.size(), 0, tag.data(), tag.size()));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Des3CbcHmacSha1_VerifyDecryptBench)->RangeMultiplier(16)->Range(64, 1 << 20);
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <vector>
+
+#include "Cipher/Block/Des/DesCrypt.hpp"
+
+using namespace Chaos::Cipher::Block::Des;
+
+static const std::array<uint8_t, DesCrypt::KeySize> KEY = { 0x13, 0x34, 0x57, 0x79, 0x9b, 0xbc, 0xdf, 0xf1 };
+
+static void DesCrypt_KeyScheduleBench(benchmark::State & state)
+{
+    DesCrypt::Key key(KEY.begin(), KEY.end());
+
+    for (auto _ : state)
+    {
+        DesCrypt::DesEncryptor enc(key);
+
+        benchmark::DoNotOptimize(enc);
+    }
+}
+
+BENCHMARK(DesCrypt_KeyScheduleBench);
+
+static void DesEncryptor_ThroughputBench(benchmark::State & state)
+{
+    std::vector<uint8_t> in(state.range(0), 0x5a);
+    std::vector<uint8_t> out(state.range(0));
+
+    DesCrypt::DesEncryptor enc(DesCrypt::Key(KEY.begin(), KEY.end()));
+
+    for (auto _ : state)
+    {
+        for (size_t offset = 0; offset < in.size(); offset += DesCrypt::BlockSize)
+        {
+            enc.EncryptBlock(out.begin() + offset, out.begin() + offset + DesCrypt::BlockSize,
+                             in.begin() + offset, in.begin() + offset + DesCrypt::BlockSize);
+        }
+
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(DesEncryptor_ThroughputBench)->RangeMultiplier(8)->Range(16, 64 << 20);
+
+static void DesDecryptor_ThroughputBench(benchmark::State & state)
+{
+    std::vector<uint8_t> in(state.range(0), 0x5a);
+    std::vector<uint8_t> out(state.range(0));
+
+    DesCrypt::DesDecryptor dec(DesCrypt::Key(KEY.begin(), KEY.end()));
+
+    for (auto _ : state)
+    {
+        for (size_t offset = 0; offset < in.size(); offset += DesCrypt::BlockSize)
+        {
+            dec.DecryptBlock(out.begin() + offset, out.begin() + offset + DesCrypt::BlockSize,
+                             in.begin() + offset, in.begin() + offset + DesCrypt::BlockSize);
+        }
+
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(DesDecryptor_ThroughputBench)->RangeMultiplier(8)->Range(16, 64 << 20);
@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "Hash/Md4.hpp"
+#include "Hash/Md5.hpp"
+#include "Hash/Sha1.hpp"
+
+#include "LatencyRecorder.hpp"
+
+using namespace Chaos::Hash::Md4;
+using namespace Chaos::Hash::Md5;
+using namespace Chaos::Hash::Sha1;
+
+using ChaosBenches::LatencyRecorder;
+
+template<typename HasherImpl, bool Cold>
+static void Hasher_LatencyBench(benchmark::State & state)
+{
+    std::vector<uint8_t> data(state.range(0), 0x5a);
+    HasherImpl hasher;
+
+    LatencyRecorder recorder(state);
+
+    for (auto _ : state)
+    {
+        if constexpr (Cold)
+        {
+            LatencyRecorder::Evict(data.data(), data.size());
+            LatencyRecorder::Evict(&hasher, sizeof(hasher));
+        }
+
+        uint64_t begin = LatencyRecorder::Now();
+
+        hasher.Reset();
+        hasher.Update(data.begin(), data.end());
+        auto result = hasher.Finish();
+
+        benchmark::DoNotOptimize(result);
+
+        recorder.Record(begin, LatencyRecorder::Now());
+    }
+}
+
+BENCHMARK_TEMPLATE(Hasher_LatencyBench, Md4Hasher, false)->Arg(0)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
+BENCHMARK_TEMPLATE(Hasher_LatencyBench, Md4Hasher, true)->Arg(0)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
+BENCHMARK_TEMPLATE(Hasher_LatencyBench, Md5Hasher, false)->Arg(0)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
+BENCHMARK_TEMPLATE(Hasher_LatencyBench, Md5Hasher, true)->Arg(0)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
+BENCHMARK_TEMPLATE(Hasher_LatencyBench, Sha1Hasher, false)->Arg(0)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
+BENCHMARK_TEMPLATE(Hasher_LatencyBench, Sha1Hasher, true)->Arg(0)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 #include <cstring>
+#include <vector>
 
 #include <Hash/Md4.hpp>
 
@@ -63,3 +64,37 @@ static void Md4Hasher_PartialUpdate100Bench(benchmark::State & state)
 }
 
 BENCHMARK(Md4Hasher_PartialUpdate100Bench);
+
+static void Md4Hasher_ThroughputBench(benchmark::State & state)
+{
+    std::vector<uint8_t> data(state.range(0), 0x5a);
+
+    for (auto _ : state)
+    {
+        Md4Hasher hasher;
+        hasher.Update(data.begin(), data.end());
+        Md4Hash result = hasher.Finish();
+
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Md4Hasher_ThroughputBench)->RangeMultiplier(8)->Range(16, 64 << 20);
+
+static void Md4_DigestBench(benchmark::State & state)
+{
+    std::vector<uint8_t> data(state.range(0), 0x5a);
+
+    for (auto _ : state)
+    {
+        Md4Hash result = Digest(data.data(), data.size());
+
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Md4_DigestBench)->Arg(16)->Arg(32)->Arg(64);
@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
+#include <algorithm>
 #include <cstring>
+#include <vector>
 
 #include <Hash/Md5.hpp>
 
@@ -63,3 +65,79 @@ static void Md5Hasher_PartialUpdate100Bench(benchmark::State & state)
 }
 
 BENCHMARK(Md5Hasher_PartialUpdate100Bench);
+
+static void Md5Hasher_ThroughputBench(benchmark::State & state)
+{
+    std::vector<uint8_t> data(state.range(0), 0x5a);
+
+    for (auto _ : state)
+    {
+        Md5Hasher hasher;
+        hasher.Update(data.begin(), data.end());
+        Md5Hash result = hasher.Finish();
+
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Md5Hasher_ThroughputBench)->RangeMultiplier(8)->Range(16, 64 << 20);
+
+static void Md5_DigestBench(benchmark::State & state)
+{
+    std::vector<uint8_t> data(state.range(0), 0x5a);
+
+    for (auto _ : state)
+    {
+        Md5Hash result = Digest(data.data(), data.size());
+
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Md5_DigestBench)->Arg(16)->Arg(32)->Arg(64);
+
+static void Md5Hasher_CopyThenUpdateBench(benchmark::State & state)
+{
+    std::vector<uint8_t> in(state.range(0), 0x5a);
+    std::vector<uint8_t> out(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::copy(in.begin(), in.end(), out.begin());
+
+        Md5Hasher hasher;
+        hasher.Update(out.begin(), out.end());
+        Md5Hash result = hasher.Finish();
+
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Md5Hasher_CopyThenUpdateBench)->RangeMultiplier(16)->Range(4 << 10, 64 << 20);
+
+static void Md5Hasher_CopyAndUpdateBench(benchmark::State & state)
+{
+    std::vector<uint8_t> in(state.range(0), 0x5a);
+    std::vector<uint8_t> out(state.range(0));
+
+    for (auto _ : state)
+    {
+        Md5Hasher hasher;
+        hasher.CopyAndUpdate(out.begin(), in.begin(), in.end());
+        Md5Hash result = hasher.Finish();
+
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Md5Hasher_CopyAndUpdateBench)->RangeMultiplier(16)->Range(4 << 10, 64 << 20);
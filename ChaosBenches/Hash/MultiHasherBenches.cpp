@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include <Hash/Md5.hpp>
+#include <Hash/Sha1.hpp>
+#include <Hash/MultiHasher.hpp>
+
+using namespace Chaos::Hash;
+
+static void Md5Sha1_TwoPassBench(benchmark::State & state)
+{
+    std::vector<uint8_t> data(state.range(0), 0x5a);
+
+    for (auto _ : state)
+    {
+        Md5::Md5Hasher md5;
+        md5.Update(data.begin(), data.end());
+
+        Sha1::Sha1Hasher sha1;
+        sha1.Update(data.begin(), data.end());
+
+        benchmark::DoNotOptimize(md5.Finish());
+        benchmark::DoNotOptimize(sha1.Finish());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Md5Sha1_TwoPassBench)->RangeMultiplier(16)->Range(4 << 10, 64 << 20);
+
+static void Md5Sha1_MultiHasherBench(benchmark::State & state)
+{
+    std::vector<uint8_t> data(state.range(0), 0x5a);
+
+    for (auto _ : state)
+    {
+        MultiHasher<Md5::Md5Hasher, Sha1::Sha1Hasher> hasher;
+        hasher.Update(data.begin(), data.end());
+
+        benchmark::DoNotOptimize(hasher.Finish());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Md5Sha1_MultiHasherBench)->RangeMultiplier(16)->Range(4 << 10, 64 << 20);
+
+static void Md5Sha1_MultiHasherParallelBench(benchmark::State & state)
+{
+    std::vector<uint8_t> data(state.range(0), 0x5a);
+
+    for (auto _ : state)
+    {
+        MultiHasher<Md5::Md5Hasher, Sha1::Sha1Hasher> hasher(1 << 20);
+        hasher.Update(data.begin(), data.end());
+
+        benchmark::DoNotOptimize(hasher.Finish());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Md5Sha1_MultiHasherParallelBench)->RangeMultiplier(16)->Range(1 << 20, 64 << 20)->UseRealTime();
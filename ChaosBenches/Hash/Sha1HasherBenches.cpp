@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 #include <cstring>
+#include <vector>
 
 #include <Hash/Sha1.hpp>
 
@@ -63,3 +64,37 @@ static void Sha1Hasher_PartialUpdate100Bench(benchmark::State & state)
 }
 
 BENCHMARK(Sha1Hasher_PartialUpdate100Bench);
+
+static void Sha1Hasher_ThroughputBench(benchmark::State & state)
+{
+    std::vector<uint8_t> data(state.range(0), 0x5a);
+
+    for (auto _ : state)
+    {
+        Sha1Hasher hasher;
+        hasher.Update(data.begin(), data.end());
+        Sha1Hash result = hasher.Finish();
+
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Sha1Hasher_ThroughputBench)->RangeMultiplier(8)->Range(16, 64 << 20);
+
+static void Sha1_DigestBench(benchmark::State & state)
+{
+    std::vector<uint8_t> data(state.range(0), 0x5a);
+
+    for (auto _ : state)
+    {
+        Sha1Hash result = Digest(data.data(), data.size());
+
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Sha1_DigestBench)->Arg(16)->Arg(32)->Arg(64);
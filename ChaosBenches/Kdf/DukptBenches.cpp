@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <vector>
+
+#include <Kdf/Dukpt.hpp>
+
+using namespace Chaos::Kdf::Dukpt;
+
+static const std::array<uint8_t, 16> BDK = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+                                             0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10 };
+static const Ksn INITIAL_KSN = { 0xff, 0xff, 0x98, 0x76, 0x54, 0x32, 0x10, 0xe0, 0x00, 0x00 };
+
+static Ksn MakeKsn(uint8_t device, uint32_t counter)
+{
+    Ksn result = INITIAL_KSN;
+
+    result[6] = device;
+    result[7] |= static_cast<uint8_t>(counter >> 16);
+    result[8] = static_cast<uint8_t>(counter >> 8);
+    result[9] = static_cast<uint8_t>(counter);
+
+    return result;
+}
+
+// Counter with ten bits set: the worst case of the derivation.
+static constexpr uint32_t WORST_COUNTER = 0x1ff800;
+
+static void Dukpt_ColdDeriveBench(benchmark::State & state)
+{
+    const Bdk bdk(BDK.begin(), BDK.end());
+    const Ksn ksn = MakeKsn(0, WORST_COUNTER);
+
+    for (auto _ : state)
+    {
+        KeyChain chain = bdk.MakeKeyChain(ksn);
+        benchmark::DoNotOptimize(chain.DeriveKey(WORST_COUNTER, KeyUsage::Pin));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(Dukpt_ColdDeriveBench);
+
+static void Dukpt_SequentialDeriveBench(benchmark::State & state)
+{
+    const Bdk bdk(BDK.begin(), BDK.end());
+    KeyChain chain = bdk.MakeKeyChain(INITIAL_KSN);
+
+    uint32_t counter = WORST_COUNTER;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(chain.DeriveKey(counter, KeyUsage::Pin));
+        counter = counter == MAX_COUNTER ? WORST_COUNTER : counter + 1;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(Dukpt_SequentialDeriveBench);
+
+static void Dukpt_DeriveKeysBench(benchmark::State & state)
+{
+    const Bdk bdk(BDK.begin(), BDK.end());
+
+    std::vector<Ksn> ksns;
+
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        ksns.push_back(MakeKsn(static_cast<uint8_t>(i % 8), WORST_COUNTER + i));
+    }
+
+    std::vector<Key> keys(ksns.size());
+
+    for (auto _ : state)
+    {
+        bdk.DeriveKeys(ksns.data(), ksns.size(), KeyUsage::Pin, keys.data());
+        benchmark::DoNotOptimize(keys.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * ksns.size());
+}
+
+BENCHMARK(Dukpt_DeriveKeysBench);
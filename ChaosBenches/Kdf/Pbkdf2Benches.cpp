@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <string>
+#include <vector>
+
+#include <Hash/Sha1.hpp>
+#include <Kdf/Pbkdf2.hpp>
+#include <Mac/Hmac.hpp>
+
+using namespace Chaos::Hash::Sha1;
+using namespace Chaos::Kdf::Pbkdf2;
+using namespace Chaos::Mac::Hmac;
+
+static const std::string PASSPHRASE = "correct horse battery staple";
+static const std::string SSID = "linksys";
+
+static void Pbkdf2_NaiveWpa2PskBench(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        std::array<uint8_t, 40> psk;
+
+        for (uint32_t block = 1; block <= 2; ++block)
+        {
+            const uint8_t index[] = { 0, 0, 0, static_cast<uint8_t>(block) };
+
+            Hmac<Sha1Hasher> hmac(PASSPHRASE.begin(), PASSPHRASE.end());
+            hmac.Update(SSID.begin(), SSID.end());
+            hmac.Update(index, index + 4);
+
+            auto u = hmac.Finish().GetRawDigest();
+            auto sum = u;
+
+            for (int i = 1; i < 4096; ++i)
+            {
+                Hmac<Sha1Hasher> next(PASSPHRASE.begin(), PASSPHRASE.end());
+                next.Update(u.begin(), u.end());
+                u = next.Finish().GetRawDigest();
+
+                for (size_t j = 0; j < sum.size(); ++j)
+                {
+                    sum[j] ^= u[j];
+                }
+            }
+
+            std::copy(sum.begin(), sum.end(), psk.begin() + (block - 1) * 20);
+        }
+
+        benchmark::DoNotOptimize(psk.data());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(Pbkdf2_NaiveWpa2PskBench);
+
+static void Pbkdf2_Wpa2PskBench(benchmark::State & state)
+{
+    const uint8_t * salt = reinterpret_cast<const uint8_t *>(SSID.data());
+
+    for (auto _ : state)
+    {
+        std::array<uint8_t, 32> psk;
+
+        const Pbkdf2<Sha1Hasher> kdf(PASSPHRASE.begin(), PASSPHRASE.end());
+        kdf.Derive(psk.data(), psk.size(), salt, SSID.size(), 4096);
+
+        benchmark::DoNotOptimize(psk.data());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(Pbkdf2_Wpa2PskBench);
+
+static void Pbkdf2_Wpa2PskBatchBench(benchmark::State & state)
+{
+    const uint8_t * salt = reinterpret_cast<const uint8_t *>(SSID.data());
+
+    std::vector<std::string> passphrases;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        passphrases.push_back(PASSPHRASE + std::to_string(i));
+    }
+
+    std::vector<std::array<uint8_t, 32>> psks(passphrases.size());
+
+    for (auto _ : state)
+    {
+        std::vector<Pbkdf2<Sha1Hasher>> kdfs;
+        std::vector<Pbkdf2<Sha1Hasher>::DeriveRequest> requests;
+
+        kdfs.reserve(passphrases.size());
+
+        for (size_t i = 0; i < passphrases.size(); ++i)
+        {
+            kdfs.emplace_back(passphrases[i].begin(), passphrases[i].end());
+            requests.push_back({ &kdfs[i], salt, SSID.size(), 4096, psks[i].data(), psks[i].size() });
+        }
+
+        Pbkdf2<Sha1Hasher>::DeriveBatch(requests.data(), requests.size());
+
+        benchmark::DoNotOptimize(psks.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * passphrases.size());
+}
+
+BENCHMARK(Pbkdf2_Wpa2PskBatchBench);
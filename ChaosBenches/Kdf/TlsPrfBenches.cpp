@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <string>
+#include <vector>
+
+#include <Hash/Md5.hpp>
+#include <Hash/Sha1.hpp>
+#include <Kdf/TlsPrf.hpp>
+#include <Mac/Hmac.hpp>
+
+using namespace Chaos::Hash::Md5;
+using namespace Chaos::Hash::Sha1;
+using namespace Chaos::Kdf::TlsPrf;
+using namespace Chaos::Mac::Hmac;
+
+static const std::array<uint8_t, 48> MASTER_SECRET = { 0x42 };
+static const std::array<uint8_t, 32> CLIENT_RANDOM = { 0x01 };
+static const std::array<uint8_t, 32> SERVER_RANDOM = { 0x02 };
+
+template<typename HasherImpl>
+static void NaiveExpandHash(const uint8_t * secret, size_t secretSize, const std::vector<uint8_t> & seed,
+                            uint8_t * out, size_t size)
+{
+    std::vector<uint8_t> a = seed;
+
+    for (size_t offset = 0; offset < size; )
+    {
+        Hmac<HasherImpl> aMac(secret, secret + secretSize);
+        aMac.Update(a.begin(), a.end());
+
+        const auto aDigest = aMac.Finish().GetRawDigest();
+        a.assign(aDigest.begin(), aDigest.end());
+
+        std::vector<uint8_t> input = a;
+        input.insert(input.end(), seed.begin(), seed.end());
+
+        Hmac<HasherImpl> mac(secret, secret + secretSize);
+        mac.Update(input.begin(), input.end());
+
+        for (uint8_t byte : mac.Finish().GetRawDigest())
+        {
+            if (offset < size)
+            {
+                out[offset++] ^= byte;
+            }
+        }
+    }
+}
+
+static void TlsPrf_NaiveKeyBlockBench(benchmark::State & state)
+{
+    const std::string label = "key expansion";
+
+    std::vector<uint8_t> keyBlock(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::vector<uint8_t> seed(label.begin(), label.end());
+        seed.insert(seed.end(), SERVER_RANDOM.begin(), SERVER_RANDOM.end());
+        seed.insert(seed.end(), CLIENT_RANDOM.begin(), CLIENT_RANDOM.end());
+
+        std::fill(keyBlock.begin(), keyBlock.end(), 0);
+
+        NaiveExpandHash<Md5Hasher>(MASTER_SECRET.data(), 24, seed, keyBlock.data(), keyBlock.size());
+        NaiveExpandHash<Sha1Hasher>(MASTER_SECRET.data() + 24, 24, seed, keyBlock.data(), keyBlock.size());
+
+        benchmark::DoNotOptimize(keyBlock.data());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(TlsPrf_NaiveKeyBlockBench)->Arg(104)->Arg(136);
+
+static void TlsPrf_KeyBlockBench(benchmark::State & state)
+{
+    const TlsPrf prf(MASTER_SECRET.begin(), MASTER_SECRET.end());
+
+    std::vector<uint8_t> keyBlock(state.range(0));
+
+    for (auto _ : state)
+    {
+        prf.ComputeKeyBlock(keyBlock.data(), keyBlock.size(), SERVER_RANDOM.data(), CLIENT_RANDOM.data());
+        benchmark::DoNotOptimize(keyBlock.data());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(TlsPrf_KeyBlockBench)->Arg(104)->Arg(136);
+
+static void TlsPrf_VerifyDataBench(benchmark::State & state)
+{
+    const TlsPrf prf(MASTER_SECRET.begin(), MASTER_SECRET.end());
+    const std::array<uint8_t, HANDSHAKE_HASHES_SIZE_BYTES> handshakeHashes = {};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(prf.ComputeVerifyData(CLIENT_FINISHED_LABEL, handshakeHashes.data()));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(TlsPrf_VerifyDataBench);
@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <string>
+#include <vector>
+
+#include <Cipher/Block/Des/DesCrypt.hpp>
+#include <Kdf/UnixCrypt.hpp>
+
+using namespace Chaos::Cipher::Block::Des;
+using namespace Chaos::Kdf::UnixCrypt;
+
+// 25 plain DES encryptions through DesEncryptor: the unsalted lower bound
+// of a crypt(3) built on the block cipher interface.
+static void UnixCrypt_DesEncryptorBench(benchmark::State & state)
+{
+    const std::string password = "password";
+
+    for (auto _ : state)
+    {
+        std::vector<uint8_t> key;
+
+        for (char c : password)
+        {
+            key.push_back(static_cast<uint8_t>(c << 1));
+        }
+
+        const DesCrypt::DesEncryptor encryptor(DesCrypt::Key(key.begin(), key.end()));
+
+        uint64_t block = 0;
+
+        for (int i = 0; i < 25; ++i)
+        {
+            block = encryptor.EncryptBlock(block);
+        }
+
+        benchmark::DoNotOptimize(block);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(UnixCrypt_DesEncryptorBench);
+
+static void UnixCrypt_VerifyBench(benchmark::State & state)
+{
+    const PasswordHash hash("zzXUHfURnGg8I");
+    const std::string password = "password";
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(hash.Verify(password.begin(), password.end()));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(UnixCrypt_VerifyBench);
+
+static void UnixCrypt_VerifyBatchBench(benchmark::State & state)
+{
+    std::vector<std::string> passwords;
+    std::vector<PasswordHash> hashes;
+
+    for (size_t i = 0; i < 64; ++i)
+    {
+        passwords.push_back("user" + std::to_string(i));
+
+        const std::string salt = { Chaos::Kdf::UnixCrypt::Inner_::ALPHABET[i],
+                                   Chaos::Kdf::UnixCrypt::Inner_::ALPHABET[63 - i] };
+
+        hashes.push_back(PasswordHash::Compute(passwords[i].begin(), passwords[i].end(), salt));
+    }
+
+    std::vector<PasswordHash::VerifyRequest> requests;
+
+    for (size_t i = 0; i < hashes.size(); ++i)
+    {
+        requests.push_back({ &hashes[i], passwords[i].data(), passwords[i].size() });
+    }
+
+    std::array<bool, 64> results;
+
+    for (auto _ : state)
+    {
+        PasswordHash::VerifyBatch(requests.data(), requests.size(), results.data());
+        benchmark::DoNotOptimize(results.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * requests.size());
+}
+
+BENCHMARK(UnixCrypt_VerifyBatchBench);
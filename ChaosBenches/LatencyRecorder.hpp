@@ -0,0 +1,108 @@
+#ifndef CHAOS_BENCHES_LATENCYRECORDER_HPP
+#define CHAOS_BENCHES_LATENCYRECORDER_HPP
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace ChaosBenches
+{
+
+class LatencyRecorder
+{
+public:
+    LatencyRecorder(benchmark::State & state)
+        : State_(state)
+    {
+        Samples_.reserve(state.max_iterations);
+    }
+
+    ~LatencyRecorder()
+    {
+        Report();
+    }
+
+    static uint64_t Now()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        unsigned int aux;
+        _mm_lfence();
+        uint64_t ticks = __rdtscp(&aux);
+        _mm_lfence();
+        return ticks;
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    static void Evict(const void * ptr, size_t size)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        const char * bytes = static_cast<const char *>(ptr);
+
+        for (size_t offset = 0; offset < size; offset += 64)
+        {
+            _mm_clflush(bytes + offset);
+        }
+
+        if (size > 0)
+        {
+            _mm_clflush(bytes + size - 1);
+        }
+
+        _mm_mfence();
+#else
+        static std::vector<uint8_t> thrash(64 << 20);
+
+        for (size_t offset = 0; offset < thrash.size(); offset += 64)
+        {
+            ++thrash[offset];
+        }
+
+        benchmark::DoNotOptimize(thrash.data());
+        benchmark::DoNotOptimize(ptr);
+        benchmark::DoNotOptimize(size);
+#endif
+    }
+
+    void Record(uint64_t begin, uint64_t end)
+    {
+        Samples_.push_back(end - begin);
+    }
+
+private:
+    benchmark::State & State_;
+    std::vector<uint64_t> Samples_;
+
+    uint64_t Percentile(double fraction)
+    {
+        size_t idx = static_cast<size_t>(fraction * (Samples_.size() - 1));
+        std::nth_element(Samples_.begin(), Samples_.begin() + idx, Samples_.end());
+
+        return Samples_[idx];
+    }
+
+    void Report()
+    {
+        if (Samples_.empty())
+        {
+            return;
+        }
+
+        State_.counters["p50"] = Percentile(0.5);
+        State_.counters["p90"] = Percentile(0.9);
+        State_.counters["p99"] = Percentile(0.99);
+        State_.counters["p99.9"] = Percentile(0.999);
+    }
+};
+
+} // namespace ChaosBenches
+
+#endif // CHAOS_BENCHES_LATENCYRECORDER_HPP
@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <vector>
+
+#include <Cipher/Block/Des/DesCrypt.hpp>
+#include <Mac/CbcMac.hpp>
+
+using namespace Chaos::Cipher::Block::Des;
+using namespace Chaos::Mac::CbcMac;
+
+static const std::array<uint8_t, 16> KEY = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+                                             0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10 };
+
+static void CbcMac_NaiveRetailMacBench(benchmark::State & state)
+{
+    const DesCrypt::DesEncryptor k1(DesCrypt::Key(KEY.begin(), KEY.begin() + 8));
+    const DesCrypt::DesDecryptor k2(DesCrypt::Key(KEY.begin() + 8, KEY.end()));
+
+    const std::vector<uint8_t> message(state.range(0), 0x5a);
+
+    for (auto _ : state)
+    {
+        std::array<uint8_t, 8> chain = {};
+
+        for (size_t offset = 0; offset < message.size(); offset += 8)
+        {
+            std::array<uint8_t, 8> block = {};
+
+            for (size_t i = 0; i < 8 && offset + i < message.size(); ++i)
+            {
+                block[i] = chain[i] ^ message[offset + i];
+            }
+
+            k1.EncryptBlock(chain.begin(), chain.end(), block.begin(), block.end());
+        }
+
+        std::array<uint8_t, 8> tag;
+        k2.DecryptBlock(tag.begin(), tag.end(), chain.begin(), chain.end());
+        k1.EncryptBlock(chain.begin(), chain.end(), tag.begin(), tag.end());
+
+        benchmark::DoNotOptimize(chain.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * message.size());
+}
+
+BENCHMARK(CbcMac_NaiveRetailMacBench)->Arg(64)->Arg(1024);
+
+static void CbcMac_RetailMacBench(benchmark::State & state)
+{
+    RetailMac mac(KEY.begin(), KEY.end());
+
+    const std::vector<uint8_t> message(state.range(0), 0x5a);
+
+    for (auto _ : state)
+    {
+        mac.Update(message.begin(), message.end());
+        benchmark::DoNotOptimize(mac.Finish());
+    }
+
+    state.SetBytesProcessed(state.iterations() * message.size());
+}
+
+BENCHMARK(CbcMac_RetailMacBench)->Arg(64)->Arg(1024);
+
+static void CbcMac_RetailMacBatchBench(benchmark::State & state)
+{
+    std::vector<RetailMac> keys;
+    std::vector<std::vector<uint8_t>> messages;
+
+    for (size_t i = 0; i < 64; ++i)
+    {
+        std::array<uint8_t, 16> key = KEY;
+        key[0] = static_cast<uint8_t>(i);
+
+        keys.emplace_back(key.begin(), key.end());
+        messages.emplace_back(state.range(0), static_cast<uint8_t>(i));
+    }
+
+    std::vector<RetailMac::Request> requests;
+
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        requests.push_back({ &keys[i], messages[i].data(), messages[i].size() });
+    }
+
+    std::vector<Tag> tags(requests.size());
+
+    for (auto _ : state)
+    {
+        RetailMac::ComputeBatch(requests.data(), requests.size(), tags.data());
+        benchmark::DoNotOptimize(tags.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * requests.size() * state.range(0));
+}
+
+BENCHMARK(CbcMac_RetailMacBatchBench)->Arg(64)->Arg(1024);
@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 #include <cstring>
+#include <vector>
 
 #include "Mac/Hmac.hpp"
 #include "Hash/Md4.hpp"
@@ -171,3 +172,57 @@ static void HmacSha1_PartialUpdate100Bench(benchmark::State & state)
 }
 
 BENCHMARK(HmacSha1_PartialUpdate100Bench);
+
+static void HmacMd4_ThroughputBench(benchmark::State & state)
+{
+    std::vector<uint8_t> data(state.range(0), 0x5a);
+
+    for (auto _ : state)
+    {
+        Hmac<Md4Hasher> hmac(KEY_BEGIN, KEY_END);
+        hmac.Update(data.begin(), data.end());
+        Md4Hash result = hmac.Finish();
+
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(HmacMd4_ThroughputBench)->RangeMultiplier(8)->Range(16, 64 << 20);
+
+static void HmacMd5_ThroughputBench(benchmark::State & state)
+{
+    std::vector<uint8_t> data(state.range(0), 0x5a);
+
+    for (auto _ : state)
+    {
+        Hmac<Md5Hasher> hmac(KEY_BEGIN, KEY_END);
+        hmac.Update(data.begin(), data.end());
+        Md5Hash result = hmac.Finish();
+
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(HmacMd5_ThroughputBench)->RangeMultiplier(8)->Range(16, 64 << 20);
+
+static void HmacSha1_ThroughputBench(benchmark::State & state)
+{
+    std::vector<uint8_t> data(state.range(0), 0x5a);
+
+    for (auto _ : state)
+    {
+        Hmac<Sha1Hasher> hmac(KEY_BEGIN, KEY_END);
+        hmac.Update(data.begin(), data.end());
+        Sha1Hash result = hmac.Finish();
+
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(HmacSha1_ThroughputBench)->RangeMultiplier(8)->Range(16, 64 << 20);
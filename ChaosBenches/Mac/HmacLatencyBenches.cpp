@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <vector>
+
+#include "Mac/Hmac.hpp"
+#include "Hash/Md4.hpp"
+#include "Hash/Md5.hpp"
+#include "Hash/Sha1.hpp"
+
+#include "LatencyRecorder.hpp"
+
+using namespace Chaos::Mac::Hmac;
+using namespace Chaos::Hash::Md4;
+using namespace Chaos::Hash::Md5;
+using namespace Chaos::Hash::Sha1;
+
+using ChaosBenches::LatencyRecorder;
+
+static const char * KEY_BEGIN = "Niccolo01234567";
+static const size_t KEY_LEN = strlen(KEY_BEGIN);
+static const char * KEY_END = KEY_BEGIN + KEY_LEN;
+
+template<typename HasherImpl, bool Cold>
+static void Hmac_LatencyBench(benchmark::State & state)
+{
+    std::vector<uint8_t> data(state.range(0), 0x5a);
+    Hmac<HasherImpl> hmac;
+
+    LatencyRecorder recorder(state);
+
+    for (auto _ : state)
+    {
+        if constexpr (Cold)
+        {
+            LatencyRecorder::Evict(data.data(), data.size());
+            LatencyRecorder::Evict(&hmac, sizeof(hmac));
+        }
+
+        uint64_t begin = LatencyRecorder::Now();
+
+        hmac.Rekey(KEY_BEGIN, KEY_END);
+        hmac.Update(data.begin(), data.end());
+        auto result = hmac.Finish();
+
+        benchmark::DoNotOptimize(result);
+
+        recorder.Record(begin, LatencyRecorder::Now());
+    }
+}
+
+BENCHMARK_TEMPLATE(Hmac_LatencyBench, Md4Hasher, false)->Arg(0)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
+BENCHMARK_TEMPLATE(Hmac_LatencyBench, Md4Hasher, true)->Arg(0)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
+BENCHMARK_TEMPLATE(Hmac_LatencyBench, Md5Hasher, false)->Arg(0)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
+BENCHMARK_TEMPLATE(Hmac_LatencyBench, Md5Hasher, true)->Arg(0)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
+BENCHMARK_TEMPLATE(Hmac_LatencyBench, Sha1Hasher, false)->Arg(0)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
+BENCHMARK_TEMPLATE(Hmac_LatencyBench, Sha1Hasher, true)->Arg(0)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(256);
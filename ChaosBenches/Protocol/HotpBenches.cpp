@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <string>
+
+#include <Hash/Sha1.hpp>
+#include <Mac/Hmac.hpp>
+#include <Protocol/Otp/Hotp.hpp>
+
+using namespace Chaos::Protocol::Otp;
+
+static const std::string SECRET = "12345678901234567890";
+
+// Five counters with a full Hmac<Sha1Hasher> rekey for each, as done
+// before the cached midstates.
+static void Hotp_RekeyWindowBench(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        uint32_t sum = 0;
+
+        for (uint64_t counter = 0; counter < 5; ++counter)
+        {
+            std::array<uint8_t, 8> message;
+
+            for (size_t i = 0; i < message.size(); ++i)
+            {
+                message[i] = static_cast<uint8_t>(counter >> (56 - i * 8));
+            }
+
+            Chaos::Mac::Hmac::Hmac<Chaos::Hash::Sha1::Sha1Hasher> mac(SECRET.begin(), SECRET.end());
+            mac.Update(message.begin(), message.end());
+
+            const auto digest = mac.Finish().GetRawDigest();
+            const size_t offset = digest[19] & 0x0f;
+
+            sum += ((static_cast<uint32_t>(digest[offset]) & 0x7f) << 24 |
+                    static_cast<uint32_t>(digest[offset + 1]) << 16 |
+                    static_cast<uint32_t>(digest[offset + 2]) << 8 |
+                    static_cast<uint32_t>(digest[offset + 3])) % 1000000;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(Hotp_RekeyWindowBench);
+
+static void Hotp_VerifyWindowBench(benchmark::State & state)
+{
+    const Totp<> totp(SECRET.begin(), SECRET.end());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(totp.Verify("000000", 1111111109, 2));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(Hotp_VerifyWindowBench);
+
+static void Hotp_ColdVerifyWindowBench(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        const Totp<> totp(SECRET.begin(), SECRET.end());
+        benchmark::DoNotOptimize(totp.Verify("000000", 1111111109, 2));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(Hotp_ColdVerifyWindowBench);
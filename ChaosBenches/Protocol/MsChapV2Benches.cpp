@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <string>
+#include <vector>
+
+#include <Protocol/MsChap/MsChapV2.hpp>
+
+using namespace Chaos::Protocol::MsChap;
+
+static const Challenge AUTHENTICATOR_CHALLENGE = { 0x5b, 0x5d, 0x7c, 0x7d, 0x7b, 0x3f, 0x2f, 0x3e,
+                                                   0x3c, 0x2c, 0x60, 0x21, 0x32, 0x26, 0x26, 0x28 };
+static const Challenge PEER_CHALLENGE = { 0x21, 0x40, 0x23, 0x24, 0x25, 0x5e, 0x26, 0x2a,
+                                          0x28, 0x29, 0x5f, 0x2b, 0x3a, 0x33, 0x7c, 0x7e };
+static const NtResponse NT_RESPONSE = { 0x82, 0x30, 0x9e, 0xcd, 0x8d, 0x70, 0x8b, 0x5e,
+                                        0xa0, 0x8f, 0xaa, 0x39, 0x81, 0xcd, 0x83, 0x54,
+                                        0x42, 0x33, 0x11, 0x4a, 0x3d, 0x85, 0xd6, 0xdf };
+static const std::string USER_NAME = "User";
+static const std::string PASSWORD = "clientPass";
+
+static void MsChapV2_VerifyFromPasswordBench(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        const Credential credential = Credential::FromPassword(PASSWORD.begin(), PASSWORD.end());
+
+        benchmark::DoNotOptimize(Verify({ &credential, AUTHENTICATOR_CHALLENGE.data(), PEER_CHALLENGE.data(),
+                                          USER_NAME.data(), USER_NAME.size(), NT_RESPONSE.data() }));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(MsChapV2_VerifyFromPasswordBench);
+
+static void MsChapV2_VerifyCachedBench(benchmark::State & state)
+{
+    const Credential credential = Credential::FromPassword(PASSWORD.begin(), PASSWORD.end());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Verify({ &credential, AUTHENTICATOR_CHALLENGE.data(), PEER_CHALLENGE.data(),
+                                          USER_NAME.data(), USER_NAME.size(), NT_RESPONSE.data() }));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(MsChapV2_VerifyCachedBench);
+
+static void MsChapV2_VerifyBatchBench(benchmark::State & state)
+{
+    const Credential credential = Credential::FromPassword(PASSWORD.begin(), PASSWORD.end());
+
+    std::vector<VerifyRequest> requests(state.range(0),
+                                        { &credential, AUTHENTICATOR_CHALLENGE.data(), PEER_CHALLENGE.data(),
+                                          USER_NAME.data(), USER_NAME.size(), NT_RESPONSE.data() });
+    std::vector<VerifyResult> results(requests.size());
+
+    for (auto _ : state)
+    {
+        VerifyBatch(requests.data(), requests.size(), results.data());
+        benchmark::DoNotOptimize(results.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(MsChapV2_VerifyBatchBench)->Arg(64)->Arg(1024);
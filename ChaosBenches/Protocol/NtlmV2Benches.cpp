@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <string>
+#include <vector>
+
+#include <Protocol/NtHash.hpp>
+#include <Protocol/Ntlm/NtlmV2.hpp>
+
+using namespace Chaos::Protocol;
+using namespace Chaos::Protocol::Ntlm;
+
+static const std::array<uint8_t, 8> SERVER_CHALLENGE = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef };
+static const std::string PASSWORD = "Password";
+static const std::string USER = "User";
+static const std::string DOMAIN = "Domain";
+
+static std::vector<uint8_t> MakeNtResponse(const ResponseKey & key)
+{
+    std::vector<uint8_t> result(16 + 64, 0xaa);
+
+    const NtProof proof = key.ComputeNtProof(SERVER_CHALLENGE.data(), result.data() + 16, result.size() - 16);
+    std::copy(proof.begin(), proof.end(), result.begin());
+
+    return result;
+}
+
+static void NtHash_ThroughputBench(benchmark::State & state)
+{
+    const std::string password(state.range(0), 'p');
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(NtHash(password.data(), password.data() + password.size()));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(NtHash_ThroughputBench)->Arg(16)->Arg(256)->Arg(4096);
+
+static void NtlmV2_VerifyFromPasswordBench(benchmark::State & state)
+{
+    const Credential credential = Credential::FromPassword(PASSWORD.begin(), PASSWORD.end());
+    const std::vector<uint8_t> ntResponse = MakeNtResponse(
+        credential.DeriveResponseKey(USER.begin(), USER.end(), DOMAIN.begin(), DOMAIN.end()));
+
+    for (auto _ : state)
+    {
+        const ResponseKey key = Credential::FromPassword(PASSWORD.begin(), PASSWORD.end())
+                                    .DeriveResponseKey(USER.begin(), USER.end(), DOMAIN.begin(), DOMAIN.end());
+
+        benchmark::DoNotOptimize(Verify({ &key, SERVER_CHALLENGE.data(), ntResponse.data(), ntResponse.size() }));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(NtlmV2_VerifyFromPasswordBench);
+
+static void NtlmV2_VerifyCachedCredentialBench(benchmark::State & state)
+{
+    const Credential credential = Credential::FromPassword(PASSWORD.begin(), PASSWORD.end());
+    const std::vector<uint8_t> ntResponse = MakeNtResponse(
+        credential.DeriveResponseKey(USER.begin(), USER.end(), DOMAIN.begin(), DOMAIN.end()));
+
+    for (auto _ : state)
+    {
+        const ResponseKey key = credential.DeriveResponseKey(USER.begin(), USER.end(), DOMAIN.begin(), DOMAIN.end());
+
+        benchmark::DoNotOptimize(Verify({ &key, SERVER_CHALLENGE.data(), ntResponse.data(), ntResponse.size() }));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(NtlmV2_VerifyCachedCredentialBench);
+
+static void NtlmV2_VerifyBatchBench(benchmark::State & state)
+{
+    const Credential credential = Credential::FromPassword(PASSWORD.begin(), PASSWORD.end());
+    const ResponseKey key = credential.DeriveResponseKey(USER.begin(), USER.end(), DOMAIN.begin(), DOMAIN.end());
+    const std::vector<uint8_t> ntResponse = MakeNtResponse(key);
+
+    std::vector<VerifyRequest> requests(state.range(0),
+                                        { &key, SERVER_CHALLENGE.data(), ntResponse.data(), ntResponse.size() });
+    std::vector<VerifyResult> results(requests.size());
+
+    for (auto _ : state)
+    {
+        VerifyBatch(requests.data(), requests.size(), results.data());
+        benchmark::DoNotOptimize(results.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(NtlmV2_VerifyBatchBench)->Arg(64)->Arg(1024);
@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <string>
+#include <vector>
+
+#include <Hash/Md5.hpp>
+#include <Protocol/Radius/RadiusCrypto.hpp>
+
+using namespace Chaos::Hash::Md5;
+using namespace Chaos::Protocol::Radius;
+
+static const std::string SECRET = "a-reasonably-long-radius-shared-secret";
+static const std::array<uint8_t, 16> REQUEST_AUTHENTICATOR = { 0x0f, 0x40, 0x3f, 0x94, 0x73, 0x97, 0x80, 0x57,
+                                                               0xbd, 0x83, 0xd5, 0xcb, 0x98, 0xf4, 0x22, 0x7a };
+
+static void Radius_NaiveHidePasswordBench(benchmark::State & state)
+{
+    const std::vector<uint8_t> password(state.range(0), 'p');
+    std::vector<uint8_t> hidden(SharedSecret::GetHiddenPasswordSize(password.size()));
+
+    for (auto _ : state)
+    {
+        std::copy(password.begin(), password.end(), hidden.begin());
+        const uint8_t * previous = REQUEST_AUTHENTICATOR.data();
+
+        for (size_t offset = 0; offset < hidden.size(); offset += 16)
+        {
+            Md5Hasher hasher;
+            hasher.Update(SECRET.begin(), SECRET.end());
+            hasher.Update(previous, previous + 16);
+
+            const auto mask = hasher.Finish().GetRawDigest();
+
+            for (size_t i = 0; i < 16; ++i)
+            {
+                hidden[offset + i] ^= mask[i];
+            }
+
+            previous = hidden.data() + offset;
+        }
+
+        benchmark::DoNotOptimize(hidden.data());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(Radius_NaiveHidePasswordBench)->Arg(16)->Arg(128);
+
+static void Radius_HidePasswordBench(benchmark::State & state)
+{
+    const SharedSecret secret(SECRET.begin(), SECRET.end());
+
+    const std::vector<uint8_t> password(state.range(0), 'p');
+    std::vector<uint8_t> hidden(SharedSecret::GetHiddenPasswordSize(password.size()));
+
+    for (auto _ : state)
+    {
+        secret.HidePassword(hidden.data(), password.data(), password.size(), REQUEST_AUTHENTICATOR.data());
+        benchmark::DoNotOptimize(hidden.data());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(Radius_HidePasswordBench)->Arg(16)->Arg(128);
+
+static void Radius_VerifyResponseBench(benchmark::State & state)
+{
+    const SharedSecret secret(SECRET.begin(), SECRET.end());
+
+    std::vector<uint8_t> packet(20 + 18 + state.range(0));
+    packet[0] = 2;
+    packet[2] = static_cast<uint8_t>(packet.size() >> 8);
+    packet[3] = static_cast<uint8_t>(packet.size());
+    packet[20] = SharedSecret::MESSAGE_AUTHENTICATOR;
+    packet[21] = 18;
+
+    for (size_t offset = 38; offset < packet.size(); offset += 200)
+    {
+        packet[offset] = 26;
+        packet[offset + 1] = static_cast<uint8_t>(std::min<size_t>(200, packet.size() - offset));
+    }
+
+    secret.SignResponse(packet.data(), packet.size(), REQUEST_AUTHENTICATOR.data());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(secret.VerifyResponse(packet.data(), packet.size(), REQUEST_AUTHENTICATOR.data()));
+    }
+
+    state.SetBytesProcessed(state.iterations() * packet.size());
+}
+
+BENCHMARK(Radius_VerifyResponseBench)->Arg(0)->Arg(400)->Arg(4000);
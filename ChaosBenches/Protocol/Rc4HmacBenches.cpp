@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <Cipher/Arc4/Arc4Crypt.hpp>
+#include <Hash/Md5.hpp>
+#include <Mac/Hmac.hpp>
+#include <Protocol/Kerberos/Rc4Hmac.hpp>
+
+using namespace Chaos::Cipher::Arc4;
+using namespace Chaos::Hash::Md5;
+using namespace Chaos::Mac::Hmac;
+using namespace Chaos::Protocol::Kerberos;
+
+static const std::array<uint8_t, 16> KEY = { 0x88, 0x46, 0xf7, 0xea, 0xee, 0x8f, 0xb1, 0x17,
+                                             0xad, 0x06, 0xbd, 0xd8, 0x30, 0xb7, 0x58, 0x6c };
+static const std::array<uint8_t, 8> CONFOUNDER = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+static const uint8_t USAGE[] = { 0x02, 0x00, 0x00, 0x00 };
+
+static void Rc4Hmac_NaiveEncryptBench(benchmark::State & state)
+{
+    std::vector<uint8_t> in(state.range(0), 0x5a);
+    std::vector<uint8_t> out(state.range(0) + Rc4Hmac::OVERHEAD_SIZE_BYTES);
+
+    for (auto _ : state)
+    {
+        Hmac<Md5Hasher> k1Mac(KEY.begin(), KEY.end());
+        k1Mac.Update(std::begin(USAGE), std::end(USAGE));
+        auto k1 = k1Mac.Finish().GetRawDigest();
+
+        std::vector<uint8_t> message(CONFOUNDER.begin(), CONFOUNDER.end());
+        message.insert(message.end(), in.begin(), in.end());
+
+        Hmac<Md5Hasher> checksumMac(k1.begin(), k1.end());
+        checksumMac.Update(message.begin(), message.end());
+        auto checksum = checksumMac.Finish().GetRawDigest();
+
+        Hmac<Md5Hasher> k3Mac(k1.begin(), k1.end());
+        k3Mac.Update(checksum.begin(), checksum.end());
+        auto k3 = k3Mac.Finish().GetRawDigest();
+
+        std::copy(checksum.begin(), checksum.end(), out.begin());
+
+        Arc4Crypt arc4(k3.begin(), k3.end());
+        arc4.Encrypt(out.data() + checksum.size(), message.data(), message.size());
+
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Rc4Hmac_NaiveEncryptBench)->Arg(256)->Arg(1024)->Arg(1500)->Arg(4096)->Arg(16384);
+
+static void Rc4Hmac_EncryptBench(benchmark::State & state)
+{
+    std::vector<uint8_t> in(state.range(0), 0x5a);
+    std::vector<uint8_t> out(state.range(0) + Rc4Hmac::OVERHEAD_SIZE_BYTES);
+
+    Rc4Hmac rc4Hmac(KEY.begin(), KEY.end());
+
+    for (auto _ : state)
+    {
+        rc4Hmac.Encrypt(out.data(), 2, CONFOUNDER.data(), in.data(), in.size());
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Rc4Hmac_EncryptBench)->Arg(256)->Arg(1024)->Arg(1500)->Arg(4096)->Arg(16384);
+
+static void Rc4Hmac_DecryptBench(benchmark::State & state)
+{
+    std::vector<uint8_t> in(state.range(0), 0x5a);
+    std::vector<uint8_t> ciphertext(state.range(0) + Rc4Hmac::OVERHEAD_SIZE_BYTES);
+
+    Rc4Hmac rc4Hmac(KEY.begin(), KEY.end());
+    rc4Hmac.Encrypt(ciphertext.data(), 2, CONFOUNDER.data(), in.data(), in.size());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(rc4Hmac.Decrypt(in.data(), 2, ciphertext.data(), ciphertext.size()));
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Rc4Hmac_DecryptBench)->Arg(256)->Arg(1024)->Arg(1500)->Arg(4096)->Arg(16384);
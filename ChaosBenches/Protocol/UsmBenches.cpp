@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <string>
+#include <vector>
+
+#include <Hash/Md5.hpp>
+#include <Hash/Sha1.hpp>
+#include <Protocol/Snmp/Usm.hpp>
+
+using namespace Chaos::Hash::Md5;
+using namespace Chaos::Hash::Sha1;
+using namespace Chaos::Protocol::Snmp;
+
+static const std::string PASSWORD = "maplesyrup";
+
+template<typename HasherImpl>
+static void Usm_NaivePasswordToKeyBench(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        HasherImpl hasher;
+        std::array<uint8_t, 64> block;
+        size_t passwordIndex = 0;
+
+        for (size_t count = 0; count < EXPANSION_SIZE_BYTES; count += block.size())
+        {
+            for (uint8_t & byte : block)
+            {
+                byte = static_cast<uint8_t>(PASSWORD[passwordIndex++ % PASSWORD.size()]);
+            }
+
+            hasher.Update(block.begin(), block.end());
+        }
+
+        benchmark::DoNotOptimize(hasher.Finish());
+    }
+
+    state.SetBytesProcessed(state.iterations() * EXPANSION_SIZE_BYTES);
+}
+
+BENCHMARK(Usm_NaivePasswordToKeyBench<Md5Hasher>);
+BENCHMARK(Usm_NaivePasswordToKeyBench<Sha1Hasher>);
+
+template<typename HasherImpl>
+static void Usm_PasswordToKeyBench(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(MasterKey<HasherImpl>::FromPassword(PASSWORD.begin(), PASSWORD.end()));
+    }
+
+    state.SetBytesProcessed(state.iterations() * EXPANSION_SIZE_BYTES);
+}
+
+BENCHMARK(Usm_PasswordToKeyBench<Md5Hasher>);
+BENCHMARK(Usm_PasswordToKeyBench<Sha1Hasher>);
+
+static void Usm_LocalizeManyBench(benchmark::State & state)
+{
+    const auto key = MasterKey<Sha1Hasher>::FromPassword(PASSWORD.begin(), PASSWORD.end());
+
+    std::vector<std::array<uint8_t, 12>> ids(1024);
+    std::vector<EngineId> engineIds;
+
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        ids[i].fill(0);
+        ids[i][10] = static_cast<uint8_t>(i >> 8);
+        ids[i][11] = static_cast<uint8_t>(i);
+        engineIds.push_back({ ids[i].data(), ids[i].size() });
+    }
+
+    std::vector<MasterKey<Sha1Hasher>::LocalizedKey> results(engineIds.size());
+
+    for (auto _ : state)
+    {
+        key.LocalizeMany(engineIds.data(), engineIds.size(), results.data(), state.range(0));
+        benchmark::DoNotOptimize(results.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * engineIds.size());
+}
+
+BENCHMARK(Usm_LocalizeManyBench)->Arg(1)->Arg(4);
+
+static void Usm_AuthenticateBench(benchmark::State & state)
+{
+    const std::array<uint8_t, 20> key = {};
+    const Authenticator<Sha1Hasher> authenticator(key.begin(), key.end());
+
+    std::vector<uint8_t> message(state.range(0), 0x5a);
+
+    for (auto _ : state)
+    {
+        authenticator.Sign(message.data(), message.size(), 32);
+        benchmark::DoNotOptimize(message.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * message.size());
+}
+
+BENCHMARK(Usm_AuthenticateBench)->Arg(128)->Arg(1400);
@@ -2,6 +2,7 @@
 #include <vector>
 #include <string>
 #include <array>
+#include <list>
 
 #include "Cipher/Arc4/Arc4Crypt.hpp"
 #include "Service/ChaosException.hpp"
@@ -216,3 +217,85 @@ TEST(Arc4CryptTests, DecryptOutIteratorUsageTest)
         ASSERT_EQ(expected, out);
     }
 }
+
+TEST(Arc4CryptTests, MoveTest)
+{
+    const std::vector<uint8_t> key = StrToU8Vec("Secret");
+    const std::vector<uint8_t> data = StrToU8Vec("Attack at dawn");
+
+    std::vector<Arc4Crypt> ciphers;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        ciphers.emplace_back(key.begin(), key.end());
+    }
+
+    for (Arc4Crypt & arc4 : ciphers)
+    {
+        std::vector<uint8_t> ciphertext(data.size());
+        arc4.Encrypt(ciphertext.begin(), data.begin(), data.size());
+
+        ASSERT_EQ(std::vector<uint8_t>({ 0x45, 0xA0, 0x1F, 0x64, 0x5F, 0xC3, 0x5B,
+                                         0x38, 0x35, 0x52, 0x54, 0x4B, 0x9B, 0xF5 }),
+                  ciphertext);
+    }
+
+    Arc4Crypt moved(std::move(ciphers.front()));
+    std::array<uint8_t, 1> out = {};
+
+    ASSERT_THROW(ciphers.front().Encrypt(out.begin(), data.begin(), 1), Chaos::Service::ChaosException);
+    ASSERT_NO_THROW(moved.Encrypt(out.begin(), data.begin(), 1));
+}
+
+TEST(Arc4CryptTests, CopyTest)
+{
+    static_assert(std::is_copy_constructible_v<Arc4Crypt> && std::is_copy_assignable_v<Arc4Crypt>);
+
+    const std::vector<uint8_t> key = StrToU8Vec("Secret");
+    const std::vector<uint8_t> data = StrToU8Vec("Attack at dawn");
+
+    Arc4Crypt arc4(key.begin(), key.end());
+    Arc4Crypt copied(arc4);
+
+    Arc4Crypt assigned;
+    assigned = arc4;
+
+    for (Arc4Crypt * crypt : { &arc4, &copied, &assigned })
+    {
+        std::vector<uint8_t> ciphertext(data.size());
+        crypt->Encrypt(ciphertext.begin(), data.begin(), data.size());
+
+        ASSERT_EQ(std::vector<uint8_t>({ 0x45, 0xA0, 0x1F, 0x64, 0x5F, 0xC3, 0x5B,
+                                         0x38, 0x35, 0x52, 0x54, 0x4B, 0x9B, 0xF5 }),
+                  ciphertext);
+    }
+}
+
+TEST(Arc4CryptTests, ContiguousMatchesIteratorTest)
+{
+    const std::vector<uint8_t> key = StrToU8Vec("Secret");
+
+    for (size_t size : { 1, 7, 8, 9, 511, 512, 513, 5000 })
+    {
+        std::vector<uint8_t> data(size);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            data[i] = static_cast<uint8_t>(i * 13 + 5);
+        }
+
+        std::vector<uint8_t> contiguous(size);
+        Arc4Crypt(key.begin(), key.end()).Encrypt(contiguous.begin(), data.begin(), size);
+
+        const std::list<uint8_t> listIn(data.begin(), data.end());
+        std::list<uint8_t> listOut(size);
+        Arc4Crypt(key.begin(), key.end()).Encrypt(listOut.begin(), listIn.begin(), size);
+
+        ASSERT_TRUE(std::equal(contiguous.begin(), contiguous.end(), listOut.begin()));
+
+        std::vector<uint8_t> inPlace = data;
+        Arc4Crypt(key.begin(), key.end()).Encrypt(inPlace.data(), inPlace.data(), size);
+
+        ASSERT_EQ(contiguous, inPlace);
+    }
+}
@@ -406,3 +406,58 @@ TEST(Arc4GenTests, GenerateOutIteratorUsageTest)
         ASSERT_EQ(expected, out);
     }
 }
+
+TEST(Arc4GenTests, MoveTest)
+{
+    uint8_t key[] = { 0x01, 0x02, 0x03, 0x04, 0x05 };
+
+    std::array<uint8_t, 8> expected = { 0xb2, 0x39, 0x63, 0x05, 0xf0, 0x3d, 0xc0, 0x27 };
+
+    {
+        Arc4Gen gen(key, key + std::size(key));
+        Arc4Gen moved(std::move(gen));
+
+        std::array<uint8_t, 8> fact = {};
+        moved.Generate(fact.begin(), fact.size());
+
+        ASSERT_EQ(expected, fact);
+        ASSERT_THROW(gen.Generate(fact.begin(), fact.size()), Chaos::Service::ChaosException);
+    }
+
+    {
+        Arc4Gen gen(key, key + std::size(key));
+
+        std::array<uint8_t, 4> fact = {};
+        gen.Generate(fact.begin(), fact.size());
+
+        Arc4Gen assigned;
+        assigned = std::move(gen);
+
+        assigned.Generate(fact.begin(), fact.size());
+
+        ASSERT_EQ((std::array<uint8_t, 4>{ 0xf0, 0x3d, 0xc0, 0x27 }), fact);
+        ASSERT_THROW(gen.Drop(1), Chaos::Service::ChaosException);
+    }
+}
+
+TEST(Arc4GenTests, CopyTest)
+{
+    static_assert(std::is_copy_constructible_v<Arc4Gen> && std::is_copy_assignable_v<Arc4Gen>);
+
+    uint8_t key[] = { 0x01, 0x02, 0x03, 0x04, 0x05 };
+
+    Arc4Gen gen(key, key + std::size(key));
+
+    std::array<uint8_t, 4> fact = {};
+    gen.Generate(fact.begin(), fact.size());
+
+    Arc4Gen copied(gen);
+    Arc4Gen assigned;
+    assigned = gen;
+
+    for (Arc4Gen * g : { &gen, &copied, &assigned })
+    {
+        g->Generate(fact.begin(), fact.size());
+        ASSERT_EQ((std::array<uint8_t, 4>{ 0xf0, 0x3d, 0xc0, 0x27 }), fact);
+    }
+}
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "Cipher/Block/CbcHmac.hpp"
+#include "Cipher/Block/Des/DesCrypt.hpp"
+#include "Cipher/Block/Des/Des3Crypt.hpp"
+#include "Hash/Sha1.hpp"
+#include "Service/ChaosException.hpp"
+#include "TestHex.hpp"
+
+using namespace Chaos::Cipher::Block;
+using namespace Chaos::Cipher::Block::Des;
+using namespace Chaos::Hash::Sha1;
+using namespace ChaosTests;
+
+static std::vector<uint8_t> MakePlaintext(size_t size)
+{
+    std::vector<uint8_t> result(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        result[i] = static_cast<uint8_t>(i * 7 + 1);
+    }
+
+    return result;
+}
+
+TEST(CbcHmacTests, DesEncryptTest)
+{
+    const std::array<uint8_t, 8> key = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef };
+    const std::string macKey = "mac key";
+    const std::string header = "hdr";
+
+    const std::vector<uint8_t> plaintext = MakePlaintext(200);
+    std::vector<uint8_t> ciphertext(plaintext.size());
+
+    DesCrypt::Key desKey(key.begin(), key.end());
+    CbcHmacEncryptor<DesCrypt::DesEncryptor, Sha1Hasher> enc(desKey, macKey.begin(), macKey.end());
+
+    enc.Authenticate(header.begin(), header.end());
+    auto tag = enc.Encrypt(ciphertext.data(), plaintext.data(), plaintext.size(), 0x1234567890abcdefULL);
+
+    ASSERT_EQ("59f49c295ded187668e90bc5119eee1c", ToHex(ciphertext.data(), 16));
+    ASSERT_EQ("6ac7be771bb62c09", ToHex(ciphertext.data() + 192, 8));
+    ASSERT_EQ("f238b9eff5509af346d6c4a3b7748524b6be5262", ToHex(tag.data(), tag.size()));
+
+    std::vector<uint8_t> again(plaintext.size());
+    enc.Authenticate(header.begin(), header.end());
+
+    ASSERT_EQ(tag, enc.Encrypt(again.data(), plaintext.data(), plaintext.size(), 0x1234567890abcdefULL));
+    ASSERT_EQ(ciphertext, again);
+}
+
+TEST(CbcHmacTests, Des3EncryptTest)
+{
+    const std::array<uint8_t, 24> key = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+                                          0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01,
+                                          0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01, 0x23 };
+    const std::string macKey = "mac key";
+
+    const std::vector<uint8_t> plaintext = MakePlaintext(200);
+    std::vector<uint8_t> ciphertext(plaintext.size());
+
+    Des3Crypt::Key desKey(key.begin(), key.end());
+    CbcHmacEncryptor<Des3Crypt::Des3Encryptor, Sha1Hasher> enc(desKey, macKey.begin(), macKey.end());
+
+    auto tag = enc.Encrypt(ciphertext.data(), plaintext.data(), plaintext.size(), 0x1234567890abcdefULL);
+
+    ASSERT_EQ("2882bd320a7563436ca5a80e2cfe01f3", ToHex(ciphertext.data(), 16));
+    ASSERT_EQ("0fb2ea9fbda251cd", ToHex(ciphertext.data() + 192, 8));
+    ASSERT_EQ("345f2a8693522bb0e7d2140d48a57e1a99f93948", ToHex(tag.data(), tag.size()));
+}
+
+TEST(CbcHmacTests, DecryptTest)
+{
+    const std::array<uint8_t, 24> key = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+                                          0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01,
+                                          0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01, 0x23 };
+    const std::string macKey = "mac key";
+
+    const std::vector<uint8_t> plaintext = MakePlaintext(1000);
+    std::vector<uint8_t> ciphertext(plaintext.size());
+
+    Des3Crypt::Key desKey(key.begin(), key.end());
+    CbcHmacEncryptor<Des3Crypt::Des3Encryptor, Sha1Hasher> enc(desKey, macKey.begin(), macKey.end());
+    CbcHmacDecryptor<Des3Crypt::Des3Decryptor, Sha1Hasher> dec(desKey, macKey.begin(), macKey.end());
+
+    auto tag = enc.Encrypt(ciphertext.data(), plaintext.data(), plaintext.size(), 42);
+
+    {
+        std::vector<uint8_t> recovered(ciphertext.size());
+
+        ASSERT_TRUE(dec.Decrypt(recovered.data(), ciphertext.data(), ciphertext.size(), 42, tag.data(), tag.size()));
+        ASSERT_EQ(plaintext, recovered);
+    }
+
+    {
+        std::vector<uint8_t> inPlace = ciphertext;
+
+        ASSERT_TRUE(dec.Decrypt(inPlace.data(), inPlace.data(), inPlace.size(), 42, tag.data(), 12));
+        ASSERT_EQ(plaintext, inPlace);
+    }
+
+    {
+        std::vector<uint8_t> tampered = ciphertext;
+        tampered[500] ^= 0x01;
+
+        std::vector<uint8_t> recovered(ciphertext.size(), 0xee);
+
+        ASSERT_FALSE(dec.Decrypt(recovered.data(), tampered.data(), tampered.size(), 42, tag.data(), tag.size()));
+        ASSERT_EQ(std::vector<uint8_t>(ciphertext.size(), 0x00), recovered);
+    }
+
+    {
+        std::vector<uint8_t> recovered(ciphertext.size());
+
+        ASSERT_TRUE(dec.Decrypt(recovered.data(), ciphertext.data(), ciphertext.size(), 42, tag.data(), tag.size()));
+        ASSERT_EQ(plaintext, recovered);
+    }
+}
+
+TEST(CbcHmacTests, AuthenticatedIvTest)
+{
+    const std::array<uint8_t, 8> key = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef };
+    const std::string macKey = "mac key";
+    const std::string header = "hdr";
+
+    const std::vector<uint8_t> plaintext = MakePlaintext(64);
+    std::vector<uint8_t> ciphertext(plaintext.size());
+
+    CbcHmacEncryptor<DesCrypt::DesEncryptor, Sha1Hasher> enc(DesCrypt::Key(key.begin(), key.end()),
+                                                             macKey.begin(), macKey.end());
+    CbcHmacDecryptor<DesCrypt::DesDecryptor, Sha1Hasher> dec(DesCrypt::Key(key.begin(), key.end()),
+                                                             macKey.begin(), macKey.end());
+
+    enc.Authenticate(header.begin(), header.end());
+    auto tag = enc.Encrypt(ciphertext.data(), plaintext.data(), plaintext.size(), 42);
+
+    std::vector<uint8_t> recovered(ciphertext.size());
+
+    dec.Authenticate(header.begin(), header.end());
+    ASSERT_FALSE(dec.Decrypt(recovered.data(), ciphertext.data(), ciphertext.size(), 42 ^ 0x01,
+                             tag.data(), tag.size()));
+
+    const std::string shiftedHeader = "hd";
+    dec.Authenticate(shiftedHeader.begin(), shiftedHeader.end());
+    ASSERT_FALSE(dec.Decrypt(recovered.data(), ciphertext.data(), ciphertext.size(), 42, tag.data(), tag.size()));
+
+    dec.Authenticate(header.begin(), header.begin() + 1);
+    dec.Authenticate(header.begin() + 1, header.end());
+    ASSERT_TRUE(dec.Decrypt(recovered.data(), ciphertext.data(), ciphertext.size(), 42, tag.data(), tag.size()));
+    ASSERT_EQ(plaintext, recovered);
+}
+
+TEST(CbcHmacTests, InvalidSizeTest)
+{
+    const std::array<uint8_t, 8> key = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef };
+    const std::string macKey = "mac key";
+
+    DesCrypt::Key desKey(key.begin(), key.end());
+    CbcHmacEncryptor<DesCrypt::DesEncryptor, Sha1Hasher> enc(desKey, macKey.begin(), macKey.end());
+    CbcHmacDecryptor<DesCrypt::DesDecryptor, Sha1Hasher> dec(desKey, macKey.begin(), macKey.end());
+
+    std::array<uint8_t, 16> buf = {};
+    std::array<uint8_t, 21> tag = {};
+
+    ASSERT_THROW(enc.Encrypt(buf.data(), buf.data(), 15, 0), Chaos::Service::ChaosException);
+    ASSERT_THROW(dec.Decrypt(buf.data(), buf.data(), 15, 0, tag.data(), 20), Chaos::Service::ChaosException);
+    ASSERT_THROW(dec.Decrypt(buf.data(), buf.data(), 16, 0, tag.data(), 0), Chaos::Service::ChaosException);
+    ASSERT_THROW(dec.Decrypt(buf.data(), buf.data(), 16, 0, tag.data(), 1), Chaos::Service::ChaosException);
+    ASSERT_THROW(dec.Decrypt(buf.data(), buf.data(), 16, 0, tag.data(), 9), Chaos::Service::ChaosException);
+    ASSERT_FALSE(dec.Decrypt(buf.data(), buf.data(), 16, 0, tag.data(), 10));
+    ASSERT_THROW(dec.Decrypt(buf.data(), buf.data(), 16, 0, tag.data(), 21), Chaos::Service::ChaosException);
+}
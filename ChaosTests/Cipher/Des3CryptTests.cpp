@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <vector>
+
+#include "Cipher/Block/Des/Des3Crypt.hpp"
+#include "Service/ChaosException.hpp"
+
+using namespace Chaos::Cipher::Block::Des;
+
+TEST(Des3CryptTests, EncryptTest)
+{
+    const std::array<uint8_t, 24> key = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+                                          0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01,
+                                          0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01, 0x23 };
+    const std::array<uint8_t, 8> data = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xe7 };
+
+    Des3Crypt::Key desKey(key.begin(), key.end());
+    Des3Crypt::Des3Encryptor enc(desKey);
+
+    std::array<uint8_t, 8> result = {};
+    enc.EncryptBlock(result.begin(), result.end(), data.begin(), data.end());
+
+    ASSERT_EQ((std::array<uint8_t, 8>{ 0x40, 0x39, 0x68, 0xfe, 0x84, 0xba, 0xa9, 0xa7 }), result);
+    ASSERT_EQ(0x403968fe84baa9a7ULL, enc.EncryptBlock(0x0123456789abcde7ULL));
+}
+
+TEST(Des3CryptTests, DecryptTest)
+{
+    const std::array<uint8_t, 24> key = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+                                          0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01,
+                                          0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01, 0x23 };
+
+    Des3Crypt::Key desKey(key.begin(), key.end());
+    Des3Crypt::Des3Decryptor dec(desKey);
+
+    ASSERT_EQ(0x0123456789abcde7ULL, dec.DecryptBlock(0x403968fe84baa9a7ULL));
+}
+
+TEST(Des3CryptTests, TwoKeyTest)
+{
+    const std::array<uint8_t, 16> key = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+                                          0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01 };
+
+    Des3Crypt::Key desKey(key.begin(), key.end());
+    Des3Crypt::Des3Encryptor enc(desKey);
+    Des3Crypt::Des3Decryptor dec(desKey);
+
+    // CBC with IV 1234567890abcdef over the bytes 01 08 0f ... (i * 7 + 1).
+    const uint64_t first = enc.EncryptBlock(0x01080f161d242b32ULL ^ 0x1234567890abcdefULL);
+    const uint64_t second = enc.EncryptBlock(0x3940474e555c636aULL ^ first);
+
+    ASSERT_EQ(0x1e5db9569b62a124ULL, first);
+    ASSERT_EQ(0xa792237e24e4614cULL, second);
+    ASSERT_EQ(0x01080f161d242b32ULL, dec.DecryptBlock(first) ^ 0x1234567890abcdefULL);
+}
+
+TEST(Des3CryptTests, InvalidKeyLengthTest)
+{
+    for (size_t size : { 0, 8, 15, 17, 23, 25 })
+    {
+        const std::vector<uint8_t> key(size, 0x11);
+
+        ASSERT_THROW(Des3Crypt::Key(key.begin(), key.end()), Chaos::Service::ChaosException);
+    }
+}
@@ -552,3 +552,57 @@ TEST(DesCryptTests, DecryptUInt64BlockThroughBaseTest)
 
     ASSERT_EQ(expected, DecryptUInt64BlockThroughBase(dec, data));
 }
+
+TEST(DesCryptTests, MoveEncryptorTest)
+{
+    std::array<uint8_t, DesCrypt::KeySize> key = { 0x13, 0x34, 0x57, 0x79, 0x9b, 0xbc, 0xdf, 0xf1 };
+
+    DesCrypt::Key desKey(key.begin(), key.end());
+    DesCrypt::DesEncryptor enc(desKey);
+
+    DesCrypt::DesEncryptor moved(std::move(enc));
+    ASSERT_EQ(0x85e813540f0ab405, moved.EncryptBlock(0x0123456789abcdef));
+
+    DesCrypt::DesEncryptor assigned(DesCrypt::Key(key.begin(), key.end()));
+    assigned = std::move(moved);
+    ASSERT_EQ(0x85e813540f0ab405, assigned.EncryptBlock(0x0123456789abcdef));
+}
+
+TEST(DesCryptTests, MoveDecryptorTest)
+{
+    std::array<uint8_t, DesCrypt::KeySize> key = { 0x13, 0x34, 0x57, 0x79, 0x9b, 0xbc, 0xdf, 0xf1 };
+
+    DesCrypt::Key desKey(key.begin(), key.end());
+    DesCrypt::DesDecryptor dec(desKey);
+
+    DesCrypt::DesDecryptor moved(std::move(dec));
+    ASSERT_EQ(0x0123456789abcdef, moved.DecryptBlock(0x85e813540f0ab405));
+}
+
+TEST(DesCryptTests, EncryptorVectorTest)
+{
+    std::vector<std::array<uint8_t, DesCrypt::KeySize>> keys =
+    {
+        { 0x13, 0x34, 0x57, 0x79, 0x9b, 0xbc, 0xdf, 0xf1 },
+        { 0x44, 0xbf, 0x32, 0x19, 0x99, 0x25, 0x81, 0x51 },
+        { 0xda, 0xec, 0x68, 0xae, 0x83, 0xe0, 0x1e, 0xab }
+    };
+
+    std::vector<uint64_t> data = { 0x0123456789abcdef, 0xaaf383162d2e6bcb, 0xe51a9fd419a79344 };
+    std::vector<uint64_t> expected = { 0x85e813540f0ab405, 0x07e87faab3171318, 0x422788a67b6c18ed };
+
+    std::vector<DesCrypt::DesEncryptor> encryptors;
+
+    for (size_t round = 0; round < 10; ++round)
+    {
+        for (const auto & key : keys)
+        {
+            encryptors.emplace_back(DesCrypt::Key(key.begin(), key.end()));
+        }
+    }
+
+    for (size_t i = 0; i < encryptors.size(); ++i)
+    {
+        ASSERT_EQ(expected[i % keys.size()], encryptors[i].EncryptBlock(data[i % keys.size()]));
+    }
+}
@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include "Cpu/Cpu.hpp"
+
+using namespace Chaos::Cpu;
+
+TEST(CpuTests, CachedFeaturesTest)
+{
+    const Features & first = GetFeatures();
+    const Features & second = GetFeatures();
+
+    ASSERT_EQ(&first, &second);
+}
+
+TEST(CpuTests, DetectIsStableTest)
+{
+    Features detected = Inner_::Detect();
+    const Features & cached = GetFeatures();
+
+    ASSERT_EQ(cached.Sse41, detected.Sse41);
+    ASSERT_EQ(cached.Avx2, detected.Avx2);
+    ASSERT_EQ(cached.Avx512F, detected.Avx512F);
+    ASSERT_EQ(cached.Avx512Bw, detected.Avx512Bw);
+    ASSERT_EQ(cached.Avx512Vl, detected.Avx512Vl);
+    ASSERT_EQ(cached.ShaNi, detected.ShaNi);
+    ASSERT_EQ(cached.Bmi2, detected.Bmi2);
+    ASSERT_EQ(cached.Gfni, detected.Gfni);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+TEST(CpuTests, MatchesCompilerBuiltinsTest)
+{
+    const Features & features = GetFeatures();
+
+    __builtin_cpu_init();
+
+    ASSERT_EQ(static_cast<bool>(__builtin_cpu_supports("sse4.1")), features.Sse41);
+    ASSERT_EQ(static_cast<bool>(__builtin_cpu_supports("avx2")), features.Avx2);
+    ASSERT_EQ(static_cast<bool>(__builtin_cpu_supports("avx512f")), features.Avx512F);
+    ASSERT_EQ(static_cast<bool>(__builtin_cpu_supports("bmi2")), features.Bmi2);
+}
+
+#endif
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include "Cpu/Dispatch.hpp"
+#include "Service/ChaosException.hpp"
+
+using namespace Chaos::Cpu;
+
+static int PortableImpl()
+{
+    return 1;
+}
+
+static int Avx2Impl()
+{
+    return 2;
+}
+
+static int ShaNiImpl()
+{
+    return 3;
+}
+
+TEST(DispatchTests, BackendNameTest)
+{
+    for (Backend backend : { Backend::Portable, Backend::Sse41, Backend::Avx2,
+                             Backend::Avx512, Backend::ShaNi })
+    {
+        ASSERT_EQ(backend, ParseBackend(GetBackendName(backend)));
+    }
+
+    ASSERT_FALSE(ParseBackend("avx1024").has_value());
+    ASSERT_FALSE(ParseBackend("").has_value());
+}
+
+TEST(DispatchTests, PortableAlwaysSupportedTest)
+{
+    ASSERT_TRUE(IsBackendSupported(Backend::Portable));
+}
+
+TEST(DispatchTests, BestSupportedTest)
+{
+    ResetForcedBackend();
+
+    Dispatcher<int (*)()> dispatcher({ { Backend::ShaNi, ShaNiImpl },
+                                       { Backend::Avx2, Avx2Impl },
+                                       { Backend::Portable, PortableImpl } });
+
+    if (IsBackendSupported(Backend::ShaNi))
+    {
+        ASSERT_EQ(Backend::ShaNi, dispatcher.GetBackend());
+        ASSERT_EQ(3, dispatcher.Get()());
+    }
+    else if (IsBackendSupported(Backend::Avx2))
+    {
+        ASSERT_EQ(Backend::Avx2, dispatcher.GetBackend());
+        ASSERT_EQ(2, dispatcher.Get()());
+    }
+    else
+    {
+        ASSERT_EQ(Backend::Portable, dispatcher.GetBackend());
+        ASSERT_EQ(1, dispatcher.Get()());
+    }
+}
+
+TEST(DispatchTests, ForceBackendTest)
+{
+    Dispatcher<int (*)()> dispatcher({ { Backend::Avx2, Avx2Impl },
+                                       { Backend::Portable, PortableImpl } });
+
+    ForceBackend(Backend::Portable);
+
+    ASSERT_EQ(Backend::Portable, GetForcedBackend());
+    ASSERT_EQ(Backend::Portable, dispatcher.GetBackend());
+    ASSERT_EQ(1, dispatcher.Get()());
+
+    if (IsBackendSupported(Backend::Avx2))
+    {
+        ForceBackend(Backend::Avx2);
+
+        ASSERT_EQ(Backend::Avx2, dispatcher.GetBackend());
+        ASSERT_EQ(2, dispatcher.Get()());
+    }
+
+    if (IsBackendSupported(Backend::ShaNi))
+    {
+        ForceBackend(Backend::ShaNi);
+
+        ASSERT_EQ(Backend::Portable, dispatcher.GetBackend());
+    }
+
+    ResetForcedBackend();
+
+    ASSERT_FALSE(GetForcedBackend().has_value());
+}
+
+TEST(DispatchTests, ForceUnsupportedBackendTest)
+{
+    for (Backend backend : { Backend::Sse41, Backend::Avx2, Backend::Avx512, Backend::ShaNi })
+    {
+        if (!IsBackendSupported(backend))
+        {
+            ASSERT_THROW(ForceBackend(backend), Chaos::Service::ChaosException);
+        }
+    }
+
+    ResetForcedBackend();
+}
+
+TEST(DispatchTests, MissingPortableCandidateTest)
+{
+    using Fn = int (*)();
+
+    ASSERT_THROW(Dispatcher<Fn>({ { Backend::Avx2, Avx2Impl } }), Chaos::Service::ChaosException);
+    ASSERT_THROW(Dispatcher<Fn>({}), Chaos::Service::ChaosException);
+}
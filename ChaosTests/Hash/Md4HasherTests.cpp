@@ -1,4 +1,8 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <vector>
 
 #include "Hash/Md4.hpp"
 
@@ -218,3 +222,109 @@ TEST(Md4Tests, ResetTest)
 
     ASSERT_EQ("31d6cfe0d16ae931b73c59d7e0c089c0", hasher.Finish().ToHexString());
 }
+
+TEST(Md4Tests, DigestTest)
+{
+    struct Helper
+    {
+        std::string operator()(const char * in) const
+        {
+            return Digest(in, strlen(in)).ToHexString();
+        }
+    };
+
+    Helper hash;
+
+    ASSERT_EQ("31d6cfe0d16ae931b73c59d7e0c089c0", hash(""));
+    ASSERT_EQ("bde52cb31de33e46245e05fbdbd6fb24", hash("a"));
+    ASSERT_EQ("a448017aaf21d8525fc10ae87aa6729d", hash("abc"));
+    ASSERT_EQ("d9130a8164549fe818874806e1c7014b", hash("message digest"));
+    ASSERT_EQ("d79e1c308aa5bbcdeea8ed63df412da9", hash("abcdefghijklmnopqrstuvwxyz"));
+    ASSERT_EQ("043f8582f241db351ce627e153e7f0e4", hash("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789"));
+    ASSERT_EQ("e33b4ddc9c38f2199c3e7b164fcc0536", hash("12345678901234567890123456789012345678901234567890123456789012345678901234567890"));
+}
+
+TEST(Md4Tests, DigestMatchesHasherTest)
+{
+    std::string in;
+
+    for (size_t len = 0; len < 300; ++len)
+    {
+        Md4Hasher hasher;
+        hasher.Update(in.begin(), in.end());
+
+        ASSERT_EQ(hasher.Finish().GetRawDigest(), Digest(in.data(), in.size()).GetRawDigest());
+
+        in.push_back(static_cast<char>('a' + len % 26));
+    }
+}
+
+TEST(Md4Tests, SegmentUpdateTest)
+{
+    const std::string header = "The quick brown ";
+    const std::string body = "fox jumps over the lazy dog";
+
+    {
+        Md4Hasher hasher;
+        hasher.Update({ { header.data(), header.size() }, { nullptr, 0 }, { body.data(), body.size() } });
+
+        ASSERT_EQ("1bee69a46ba811185c194762abaeae90", hasher.Finish().ToHexString());
+    }
+
+    {
+        std::string in;
+
+        for (size_t len = 0; len < 300; ++len)
+        {
+            in.push_back(static_cast<char>('a' + len % 26));
+        }
+
+        std::vector<Chaos::Hash::Segment> segments;
+
+        for (size_t offset = 0, size = 1; offset < in.size(); offset += size, size = size * 3 % 71)
+        {
+            segments.push_back({ in.data() + offset, std::min(size, in.size() - offset) });
+        }
+
+        Md4Hasher hasher;
+        hasher.Update(segments);
+
+        ASSERT_EQ(Digest(in.data(), in.size()).GetRawDigest(), hasher.Finish().GetRawDigest());
+    }
+}
+
+TEST(Md4Tests, CopyAndUpdateTest)
+{
+    for (size_t size : { 0, 1, 63, 64, 65, 1000, 300000 })
+    {
+        std::vector<uint8_t> in(size);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            in[i] = static_cast<uint8_t>(i * 31 + 7);
+        }
+
+        std::vector<uint8_t> out(size + 3, 0xee);
+
+        Md4Hasher hasher;
+        hasher.Update(in.begin(), in.begin() + size / 3);
+
+        auto outIt = hasher.CopyAndUpdate(out.begin(), in.begin() + size / 3, in.end());
+
+        ASSERT_EQ(out.begin() + (size - size / 3), outIt);
+        ASSERT_TRUE(std::equal(in.begin() + size / 3, in.end(), out.begin()));
+        ASSERT_EQ(0xee, out[size - size / 3]);
+        ASSERT_EQ(Digest(in.data(), in.size()).GetRawDigest(), hasher.Finish().GetRawDigest());
+    }
+
+    {
+        const std::list<char> in = { 'a', 'b', 'c' };
+        std::list<char> out;
+
+        Md4Hasher hasher;
+        hasher.CopyAndUpdate(std::back_inserter(out), in.begin(), in.end());
+
+        ASSERT_EQ(in, out);
+        ASSERT_EQ(Digest("abc", 3).GetRawDigest(), hasher.Finish().GetRawDigest());
+    }
+}
@@ -1,4 +1,8 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <vector>
 
 #include "Hash/Md5.hpp"
 
@@ -218,3 +222,109 @@ TEST(Md5Tests, ResetTest)
 
     ASSERT_EQ("d41d8cd98f00b204e9800998ecf8427e", hasher.Finish().ToHexString());
 }
+
+TEST(Md5Tests, DigestTest)
+{
+    struct Helper
+    {
+        std::string operator()(const char * in) const
+        {
+            return Digest(in, strlen(in)).ToHexString();
+        }
+    };
+
+    Helper hash;
+
+    ASSERT_EQ("d41d8cd98f00b204e9800998ecf8427e", hash(""));
+    ASSERT_EQ("0cc175b9c0f1b6a831c399e269772661", hash("a"));
+    ASSERT_EQ("900150983cd24fb0d6963f7d28e17f72", hash("abc"));
+    ASSERT_EQ("f96b697d7cb7938d525a2f31aaf161d0", hash("message digest"));
+    ASSERT_EQ("c3fcd3d76192e4007dfb496cca67e13b", hash("abcdefghijklmnopqrstuvwxyz"));
+    ASSERT_EQ("d174ab98d277d9f5a5611c2c9f419d9f", hash("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789"));
+    ASSERT_EQ("57edf4a22be3c955ac49da2e2107b67a", hash("12345678901234567890123456789012345678901234567890123456789012345678901234567890"));
+}
+
+TEST(Md5Tests, DigestMatchesHasherTest)
+{
+    std::string in;
+
+    for (size_t len = 0; len < 300; ++len)
+    {
+        Md5Hasher hasher;
+        hasher.Update(in.begin(), in.end());
+
+        ASSERT_EQ(hasher.Finish().GetRawDigest(), Digest(in.data(), in.size()).GetRawDigest());
+
+        in.push_back(static_cast<char>('a' + len % 26));
+    }
+}
+
+TEST(Md5Tests, SegmentUpdateTest)
+{
+    const std::string header = "The quick brown ";
+    const std::string body = "fox jumps over the lazy dog";
+
+    {
+        Md5Hasher hasher;
+        hasher.Update({ { header.data(), header.size() }, { nullptr, 0 }, { body.data(), body.size() } });
+
+        ASSERT_EQ("9e107d9d372bb6826bd81d3542a419d6", hasher.Finish().ToHexString());
+    }
+
+    {
+        std::string in;
+
+        for (size_t len = 0; len < 300; ++len)
+        {
+            in.push_back(static_cast<char>('a' + len % 26));
+        }
+
+        std::vector<Chaos::Hash::Segment> segments;
+
+        for (size_t offset = 0, size = 1; offset < in.size(); offset += size, size = size * 3 % 71)
+        {
+            segments.push_back({ in.data() + offset, std::min(size, in.size() - offset) });
+        }
+
+        Md5Hasher hasher;
+        hasher.Update(segments);
+
+        ASSERT_EQ(Digest(in.data(), in.size()).GetRawDigest(), hasher.Finish().GetRawDigest());
+    }
+}
+
+TEST(Md5Tests, CopyAndUpdateTest)
+{
+    for (size_t size : { 0, 1, 63, 64, 65, 1000, 300000 })
+    {
+        std::vector<uint8_t> in(size);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            in[i] = static_cast<uint8_t>(i * 31 + 7);
+        }
+
+        std::vector<uint8_t> out(size + 3, 0xee);
+
+        Md5Hasher hasher;
+        hasher.Update(in.begin(), in.begin() + size / 3);
+
+        auto outIt = hasher.CopyAndUpdate(out.begin(), in.begin() + size / 3, in.end());
+
+        ASSERT_EQ(out.begin() + (size - size / 3), outIt);
+        ASSERT_TRUE(std::equal(in.begin() + size / 3, in.end(), out.begin()));
+        ASSERT_EQ(0xee, out[size - size / 3]);
+        ASSERT_EQ(Digest(in.data(), in.size()).GetRawDigest(), hasher.Finish().GetRawDigest());
+    }
+
+    {
+        const std::list<char> in = { 'a', 'b', 'c' };
+        std::list<char> out;
+
+        Md5Hasher hasher;
+        hasher.CopyAndUpdate(std::back_inserter(out), in.begin(), in.end());
+
+        ASSERT_EQ(in, out);
+        ASSERT_EQ(Digest("abc", 3).GetRawDigest(), hasher.Finish().GetRawDigest());
+    }
+}
@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "Hash/MerkleDamgard.hpp"
+#include "Hash/Md5.hpp"
+#include "Hash/Sha1.hpp"
+
+using namespace Chaos::Hash;
+
+namespace
+{
+
+template<ByteOrder Order>
+struct RecordingTraits
+{
+    struct Buffer
+    {
+        uint32_t Regs_[2] = { 0x01020304, 0xa0b0c0d0 };
+    };
+
+    using Block = std::array<uint32_t, 16>;
+
+    static constexpr ByteOrder WORD_ORDER = Order;
+    static constexpr size_t LENGTH_SIZE_BYTES = 8;
+
+    static inline std::vector<Block> Blocks_;
+
+    static void Compress(Buffer & buffer, const Block & block)
+    {
+        Blocks_.push_back(block);
+        ++buffer.Regs_[0];
+    }
+};
+
+} // namespace
+
+TEST(MerkleDamgardTests, LittleEndianPaddingTest)
+{
+    using Traits = RecordingTraits<ByteOrder::LittleEndian>;
+
+    {
+        Traits::Blocks_.clear();
+
+        MerkleDamgard<Traits> engine;
+
+        const std::string in = "abc";
+        engine.Update(in.begin(), in.end());
+
+        std::array<uint8_t, 8> digest;
+        engine.Finish(digest.data());
+
+        ASSERT_EQ(1, Traits::Blocks_.size());
+        ASSERT_EQ(0x80636261, Traits::Blocks_[0][0]);
+
+        for (size_t i = 1; i < 14; ++i)
+        {
+            ASSERT_EQ(0, Traits::Blocks_[0][i]);
+        }
+
+        ASSERT_EQ(24, Traits::Blocks_[0][14]);
+        ASSERT_EQ(0, Traits::Blocks_[0][15]);
+
+        ASSERT_EQ((std::array<uint8_t, 8>{ 0x05, 0x03, 0x02, 0x01, 0xd0, 0xc0, 0xb0, 0xa0 }), digest);
+    }
+
+    for (size_t size : { 55, 56, 63, 64 })
+    {
+        Traits::Blocks_.clear();
+
+        MerkleDamgard<Traits> engine;
+
+        const std::vector<uint8_t> in(size, 0x11);
+        engine.Update(in.data(), in.size());
+
+        std::array<uint8_t, 8> digest;
+        engine.Finish(digest.data());
+
+        ASSERT_EQ(size < 56 ? 1 : 2, Traits::Blocks_.size());
+        ASSERT_EQ(size * 8, Traits::Blocks_.back()[14]);
+        ASSERT_EQ(size, engine.GetMessageSize());
+    }
+}
+
+TEST(MerkleDamgardTests, BigEndianPaddingTest)
+{
+    using Traits = RecordingTraits<ByteOrder::BigEndian>;
+
+    Traits::Blocks_.clear();
+
+    MerkleDamgard<Traits> engine;
+
+    const std::string in = "abc";
+    engine.Update(in.begin(), in.end());
+
+    std::array<uint8_t, 8> digest;
+    engine.Finish(digest.data());
+
+    ASSERT_EQ(1, Traits::Blocks_.size());
+    ASSERT_EQ(0x61626380, Traits::Blocks_[0][0]);
+    ASSERT_EQ(0, Traits::Blocks_[0][14]);
+    ASSERT_EQ(24, Traits::Blocks_[0][15]);
+
+    ASSERT_EQ((std::array<uint8_t, 8>{ 0x01, 0x02, 0x03, 0x05, 0xa0, 0xb0, 0xc0, 0xd0 }), digest);
+}
+
+TEST(MerkleDamgardTests, NonContiguousInputTest)
+{
+    std::string in;
+
+    for (size_t i = 0; i < 300; ++i)
+    {
+        in.push_back(static_cast<char>('a' + i % 26));
+    }
+
+    const std::list<char> list(in.begin(), in.end());
+
+    for (size_t split : { 0, 1, 63, 64, 65, 200, 300 })
+    {
+        {
+            Md5::Md5Hasher contiguous;
+            contiguous.Update(in.begin(), in.begin() + split);
+            contiguous.Update(in.begin() + split, in.end());
+
+            Md5::Md5Hasher nonContiguous;
+            nonContiguous.Update(list.begin(), std::next(list.begin(), split));
+            nonContiguous.Update(std::next(list.begin(), split), list.end());
+
+            ASSERT_EQ(contiguous.Finish().GetRawDigest(), nonContiguous.Finish().GetRawDigest());
+        }
+
+        {
+            Sha1::Sha1Hasher contiguous;
+            contiguous.Update(in.data(), in.data() + split);
+            contiguous.Update(list.begin(), list.end());
+
+            Sha1::Sha1Hasher mixed;
+            mixed.Update(std::next(list.begin(), 0), std::next(list.begin(), split));
+            mixed.Update(in.begin(), in.end());
+
+            ASSERT_EQ(contiguous.Finish().GetRawDigest(), mixed.Finish().GetRawDigest());
+        }
+    }
+}
+
+TEST(MerkleDamgardTests, FinalBlockTest)
+{
+    using Traits = RecordingTraits<ByteOrder::BigEndian>;
+    using Engine = MerkleDamgard<Traits>;
+
+    for (size_t payloadSize : { 0, 8, 20, 55 })
+    {
+        Traits::Blocks_.clear();
+
+        Engine engine;
+
+        const std::vector<uint8_t> in(Engine::BLOCK_SIZE_BYTES + payloadSize, 0x00);
+        engine.Update(in.data(), in.size());
+
+        std::array<uint8_t, 8> digest;
+        engine.Finish(digest.data());
+
+        ASSERT_EQ(2, Traits::Blocks_.size());
+        ASSERT_EQ(Traits::Blocks_[1], Engine::MakeFinalBlock(Engine::BLOCK_SIZE_BYTES, payloadSize));
+    }
+
+    using LittleTraits = RecordingTraits<ByteOrder::LittleEndian>;
+    using LittleEngine = MerkleDamgard<LittleTraits>;
+
+    const LittleEngine::Block block = LittleEngine::MakeFinalBlock(64, 16);
+
+    ASSERT_EQ(0x80, block[4]);
+    ASSERT_EQ(640, block[14]);
+    ASSERT_EQ(0, block[15]);
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "Hash/Md4.hpp"
+#include "Hash/Md5.hpp"
+#include "Hash/Sha1.hpp"
+#include "Hash/MultiHasher.hpp"
+
+using namespace Chaos::Hash;
+
+TEST(MultiHasherTests, BasicTest)
+{
+    const std::string in = "The quick brown fox jumps over the lazy dog";
+
+    MultiHasher<Md4::Md4Hasher, Md5::Md5Hasher, Sha1::Sha1Hasher> hasher;
+    hasher.Update(in.begin(), in.end());
+
+    auto [md4, md5, sha1] = hasher.Finish();
+
+    ASSERT_EQ("1bee69a46ba811185c194762abaeae90", md4.ToHexString());
+    ASSERT_EQ("9e107d9d372bb6826bd81d3542a419d6", md5.ToHexString());
+    ASSERT_EQ("2fd4e1c67a2d28fced849ee1bb76e7391b93eb12", sha1.ToHexString());
+}
+
+TEST(MultiHasherTests, MatchesSingleHashersTest)
+{
+    std::vector<uint8_t> in;
+
+    for (size_t i = 0; i < 5000; ++i)
+    {
+        in.push_back(static_cast<uint8_t>(i * 7 + 3));
+    }
+
+    const std::list<uint8_t> list(in.begin(), in.end());
+
+    for (size_t split : { 0, 1, 63, 1024, 1025, 4999, 5000 })
+    {
+        MultiHasher<Md5::Md5Hasher, Sha1::Sha1Hasher> hasher;
+        hasher.Update(in.begin(), in.begin() + split);
+        hasher.Update(std::next(list.begin(), split), list.end());
+
+        auto [md5, sha1] = hasher.Finish();
+
+        ASSERT_EQ(Md5::Digest(in.data(), in.size()).GetRawDigest(), md5.GetRawDigest());
+        ASSERT_EQ(Sha1::Digest(in.data(), in.size()).GetRawDigest(), sha1.GetRawDigest());
+    }
+}
+
+TEST(MultiHasherTests, ParallelTest)
+{
+    std::vector<uint8_t> in(100000, 0x5a);
+
+    MultiHasher<Md4::Md4Hasher, Md5::Md5Hasher, Sha1::Sha1Hasher> hasher(4096);
+    ASSERT_EQ(4096, hasher.GetParallelThreshold());
+
+    hasher.Update(in.data(), in.data() + 1000);
+    hasher.Update(in.data() + 1000, in.data() + in.size());
+
+    auto [md4, md5, sha1] = hasher.Finish();
+
+    ASSERT_EQ(Md4::Digest(in.data(), in.size()).GetRawDigest(), md4.GetRawDigest());
+    ASSERT_EQ(Md5::Digest(in.data(), in.size()).GetRawDigest(), md5.GetRawDigest());
+    ASSERT_EQ(Sha1::Digest(in.data(), in.size()).GetRawDigest(), sha1.GetRawDigest());
+}
+
+TEST(MultiHasherTests, SegmentUpdateTest)
+{
+    const std::string header = "The quick brown ";
+    const std::string body = "fox jumps over the lazy dog";
+
+    MultiHasher<Md5::Md5Hasher, Sha1::Sha1Hasher> hasher;
+    hasher.Update({ { header.data(), header.size() }, { body.data(), body.size() } });
+
+    auto [md5, sha1] = hasher.Finish();
+
+    ASSERT_EQ("9e107d9d372bb6826bd81d3542a419d6", md5.ToHexString());
+    ASSERT_EQ("2fd4e1c67a2d28fced849ee1bb76e7391b93eb12", sha1.ToHexString());
+}
+
+TEST(MultiHasherTests, ResetTest)
+{
+    MultiHasher<Md5::Md5Hasher, Sha1::Sha1Hasher> hasher;
+
+    const std::string in = "abc";
+    hasher.Update(in.begin(), in.end());
+    hasher.Reset();
+
+    auto [md5, sha1] = hasher.Finish();
+
+    ASSERT_EQ("d41d8cd98f00b204e9800998ecf8427e", md5.ToHexString());
+    ASSERT_EQ("da39a3ee5e6b4b0d3255bfef95601890afd80709", sha1.ToHexString());
+}
+
+TEST(MultiHasherTests, CopyAndUpdateTest)
+{
+    for (size_t size : { 0, 1, 1023, 1024, 1025, 5000 })
+    {
+        std::vector<uint8_t> in(size);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            in[i] = static_cast<uint8_t>(i * 31 + 7);
+        }
+
+        for (size_t threshold : { static_cast<size_t>(1), MultiHasher<Md5::Md5Hasher>::NO_PARALLEL_THRESHOLD })
+        {
+            std::vector<uint8_t> out(size + 3, 0xee);
+
+            MultiHasher<Md5::Md5Hasher, Sha1::Sha1Hasher> hasher(threshold);
+            hasher.Update(in.begin(), in.begin() + size / 3);
+
+            Hasher<MultiHasher<Md5::Md5Hasher, Sha1::Sha1Hasher>> & base = hasher;
+            auto outIt = base.CopyAndUpdate(out.begin(), in.begin() + size / 3, in.end());
+
+            ASSERT_EQ(out.begin() + (size - size / 3), outIt);
+            ASSERT_TRUE(std::equal(in.begin() + size / 3, in.end(), out.begin()));
+            ASSERT_EQ(0xee, out[size - size / 3]);
+
+            auto [md5, sha1] = hasher.Finish();
+
+            ASSERT_EQ(Md5::Digest(in.data(), in.size()).GetRawDigest(), md5.GetRawDigest());
+            ASSERT_EQ(Sha1::Digest(in.data(), in.size()).GetRawDigest(), sha1.GetRawDigest());
+        }
+    }
+
+    {
+        const std::list<char> in = { 'a', 'b', 'c' };
+        std::list<char> out;
+
+        MultiHasher<Md5::Md5Hasher, Sha1::Sha1Hasher> hasher;
+        hasher.CopyAndUpdate(std::back_inserter(out), in.begin(), in.end());
+
+        ASSERT_EQ(in, out);
+
+        auto [md5, sha1] = hasher.Finish();
+
+        ASSERT_EQ("900150983cd24fb0d6963f7d28e17f72", md5.ToHexString());
+        ASSERT_EQ("a9993e364706816aba3e25717850c26c9cd0d89d", sha1.ToHexString());
+    }
+}
@@ -1,7 +1,13 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <vector>
 
+#include "Cpu/Dispatch.hpp"
 #include "Hash/Sha1.hpp"
 
+using namespace Chaos::Cpu;
 using namespace Chaos::Hash::Sha1;
 
 TEST(Sha1Tests, RfcTest)
@@ -218,3 +224,144 @@ TEST(Sha1Tests, ResetTest)
 
     ASSERT_EQ("da39a3ee5e6b4b0d3255bfef95601890afd80709", hasher.Finish().ToHexString());
 }
+
+TEST(Sha1Tests, BackendsTest)
+{
+    struct Helper
+    {
+        std::string operator()(const std::string & in) const
+        {
+            Sha1Hasher hasher;
+            hasher.Update(in.begin(), in.end());
+            return hasher.Finish().ToHexString();
+        }
+    };
+
+    Helper hash;
+
+    for (Backend backend : { Backend::Portable, Backend::Avx2, Backend::ShaNi })
+    {
+        if (!IsBackendSupported(backend))
+        {
+            continue;
+        }
+
+        ForceBackend(backend);
+
+        ASSERT_EQ("da39a3ee5e6b4b0d3255bfef95601890afd80709", hash(""));
+        ASSERT_EQ("a9993e364706816aba3e25717850c26c9cd0d89d", hash("abc"));
+        ASSERT_EQ("84983e441c3bd26ebaae4aa1f95129e5e54670f1", hash("abcdbcdecdefdefgefghfghighijhi"
+                                                                   "jkijkljklmklmnlmnomnopnopq"));
+        ASSERT_EQ("79e7958997241a7ffe484e14cbe1a41a088aa70b", hash(std::string(2500, '0')));
+        ASSERT_EQ("246f7ca16d5edebf7a5df7ddeab7c044745942ec", hash(std::string(1000, 'a') +
+                                                                   std::string(1000, 'b')));
+    }
+
+    ResetForcedBackend();
+}
+
+TEST(Sha1Tests, DigestTest)
+{
+    struct Helper
+    {
+        std::string operator()(const char * in) const
+        {
+            return Digest(in, strlen(in)).ToHexString();
+        }
+    };
+
+    Helper hash;
+
+    ASSERT_EQ("da39a3ee5e6b4b0d3255bfef95601890afd80709", hash(""));
+    ASSERT_EQ("86f7e437faa5a7fce15d1ddcb9eaeaea377667b8", hash("a"));
+    ASSERT_EQ("a9993e364706816aba3e25717850c26c9cd0d89d", hash("abc"));
+    ASSERT_EQ("84983e441c3bd26ebaae4aa1f95129e5e54670f1", hash("abcdbcdecdefdefgefghfghighijhi"
+                                                               "jkijkljklmklmnlmnomnopnopq"));
+    ASSERT_EQ("e0c094e867ef46c350ef54a7f59dd60bed92ae83", hash("01234567012345670123456701234567"
+                                                               "01234567012345670123456701234567"));
+}
+
+TEST(Sha1Tests, DigestMatchesHasherTest)
+{
+    std::string in;
+
+    for (size_t len = 0; len < 300; ++len)
+    {
+        Sha1Hasher hasher;
+        hasher.Update(in.begin(), in.end());
+
+        ASSERT_EQ(hasher.Finish().GetRawDigest(), Digest(in.data(), in.size()).GetRawDigest());
+
+        in.push_back(static_cast<char>('a' + len % 26));
+    }
+}
+
+TEST(Sha1Tests, SegmentUpdateTest)
+{
+    const std::string header = "The quick brown ";
+    const std::string body = "fox jumps over the lazy dog";
+
+    {
+        Sha1Hasher hasher;
+        hasher.Update({ { header.data(), header.size() }, { nullptr, 0 }, { body.data(), body.size() } });
+
+        ASSERT_EQ("2fd4e1c67a2d28fced849ee1bb76e7391b93eb12", hasher.Finish().ToHexString());
+    }
+
+    {
+        std::string in;
+
+        for (size_t len = 0; len < 300; ++len)
+        {
+            in.push_back(static_cast<char>('a' + len % 26));
+        }
+
+        std::vector<Chaos::Hash::Segment> segments;
+
+        for (size_t offset = 0, size = 1; offset < in.size(); offset += size, size = size * 3 % 71)
+        {
+            segments.push_back({ in.data() + offset, std::min(size, in.size() - offset) });
+        }
+
+        Sha1Hasher hasher;
+        hasher.Update(segments);
+
+        ASSERT_EQ(Digest(in.data(), in.size()).GetRawDigest(), hasher.Finish().GetRawDigest());
+    }
+}
+
+TEST(Sha1Tests, CopyAndUpdateTest)
+{
+    for (size_t size : { 0, 1, 63, 64, 65, 1000, 300000 })
+    {
+        std::vector<uint8_t> in(size);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            in[i] = static_cast<uint8_t>(i * 31 + 7);
+        }
+
+        std::vector<uint8_t> out(size + 3, 0xee);
+
+        Sha1Hasher hasher;
+        hasher.Update(in.begin(), in.begin() + size / 3);
+
+        auto outIt = hasher.CopyAndUpdate(out.begin(), in.begin() + size / 3, in.end());
+
+        ASSERT_EQ(out.begin() + (size - size / 3), outIt);
+        ASSERT_TRUE(std::equal(in.begin() + size / 3, in.end(), out.begin()));
+        ASSERT_EQ(0xee, out[size - size / 3]);
+        ASSERT_EQ(Digest(in.data(), in.size()).GetRawDigest(), hasher.Finish().GetRawDigest());
+    }
+
+    {
+        const std::list<char> in = { 'a', 'b', 'c' };
+        std::list<char> out;
+
+        Sha1Hasher hasher;
+        hasher.CopyAndUpdate(std::back_inserter(out), in.begin(), in.end());
+
+        ASSERT_EQ(in, out);
+        ASSERT_EQ(Digest("abc", 3).GetRawDigest(), hasher.Finish().GetRawDigest());
+    }
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "Kdf/Dukpt.hpp"
+#include "Service/ChaosException.hpp"
+#include "TestHex.hpp"
+
+using namespace Chaos::Kdf::Dukpt;
+using namespace ChaosTests;
+
+static const std::vector<uint8_t> BDK = FromHex("0123456789ABCDEFFEDCBA9876543210");
+static const Ksn INITIAL_KSN = { 0xff, 0xff, 0x98, 0x76, 0x54, 0x32, 0x10, 0xe0, 0x00, 0x00 };
+
+static Ksn MakeKsn(uint32_t counter)
+{
+    Ksn result = INITIAL_KSN;
+
+    result[7] |= static_cast<uint8_t>(counter >> 16);
+    result[8] = static_cast<uint8_t>(counter >> 8);
+    result[9] = static_cast<uint8_t>(counter);
+
+    return result;
+}
+
+TEST(DukptTests, IpekTest)
+{
+    const Bdk bdk(BDK.begin(), BDK.end());
+
+    ASSERT_EQ("6ac292faa1315b4d858ab3a3d7d5933a", ToHex(bdk.DeriveIpek(INITIAL_KSN)));
+    ASSERT_EQ("6ac292faa1315b4d858ab3a3d7d5933a", ToHex(bdk.DeriveIpek(MakeKsn(0x1fffff))));
+}
+
+TEST(DukptTests, PinKeyTest)
+{
+    const Bdk bdk(BDK.begin(), BDK.end());
+    KeyChain chain = bdk.MakeKeyChain(INITIAL_KSN);
+
+    ASSERT_EQ("042666b49184cf5c68de9628d0397b36", ToHex(chain.DeriveKey(1, KeyUsage::Pin)));
+    ASSERT_EQ("c46551cef9fd244faa9ad834130d3b38", ToHex(chain.DeriveKey(2, KeyUsage::Pin)));
+    ASSERT_EQ("0df3d9422aca561a47676d07ad6bad05", ToHex(chain.DeriveKey(3, KeyUsage::Pin)));
+}
+
+TEST(DukptTests, KeyUsageTest)
+{
+    const Bdk bdk(BDK.begin(), BDK.end());
+    KeyChain chain = bdk.MakeKeyChain(INITIAL_KSN);
+
+    ASSERT_EQ("042666b49184cfa368de9628d0397bc9", ToHex(chain.DeriveTransactionKey(1)));
+    ASSERT_EQ("042666b4918430a368de9628d03984c9", ToHex(chain.DeriveKey(1, KeyUsage::MacRequest)));
+    ASSERT_EQ("042666b46e84cfa368de96282f397bc9", ToHex(chain.DeriveKey(1, KeyUsage::MacResponse)));
+    ASSERT_EQ("448d3f076d8304036a55a3d7e0055a78", ToHex(chain.DeriveKey(1, KeyUsage::DataRequest)));
+    ASSERT_EQ("ad7bfc8b06ad3a08a560b4105cf8d9e5", ToHex(chain.DeriveKey(1, KeyUsage::DataResponse)));
+}
+
+TEST(DukptTests, CounterOrderTest)
+{
+    const Bdk bdk(BDK.begin(), BDK.end());
+
+    const std::vector<std::pair<uint32_t, std::string>> expected =
+    {
+        { 0x1fffff, "9d3a9bed76215a4f2137ea76bc0d6176" },
+        { 0x00000f, "93dd5b956c4878472e453aaefd32a5aa" },
+        { 0x000010, "59598dcbd9bd94c094165ce453585f57" },
+        { 0x0a1b2c, "b2bd7e680bac04776bf13696d1b75913" },
+        { 0x000003, "0df3d9422aca56e547676d07ad6badfa" },
+        { 0x000000, "6ac292faa1315b4d858ab3a3d7d5933a" }
+    };
+
+    KeyChain chain = bdk.MakeKeyChain(INITIAL_KSN);
+
+    for (const auto & [counter, key] : expected)
+    {
+        ASSERT_EQ(key, ToHex(chain.DeriveTransactionKey(counter)));
+        ASSERT_EQ(key, ToHex(chain.DeriveTransactionKey(counter)));
+    }
+
+    for (const auto & [counter, key] : expected)
+    {
+        KeyChain fresh = bdk.MakeKeyChain(MakeKsn(counter));
+        ASSERT_EQ(key, ToHex(fresh.DeriveTransactionKey(counter)));
+    }
+
+    ASSERT_THROW(chain.DeriveTransactionKey(0x200000), Chaos::Service::ChaosException);
+}
+
+TEST(DukptTests, DeriveKeysTest)
+{
+    const Bdk bdk(BDK.begin(), BDK.end());
+
+    Ksn otherKsn = MakeKsn(1);
+    otherKsn[0] = 0x12;
+
+    const std::vector<Ksn> ksns = { MakeKsn(3), otherKsn, MakeKsn(1), MakeKsn(2), otherKsn, MakeKsn(1) };
+    std::vector<Key> keys(ksns.size());
+
+    bdk.DeriveKeys(ksns.data(), ksns.size(), KeyUsage::Pin, keys.data());
+
+    ASSERT_EQ("0df3d9422aca561a47676d07ad6bad05", ToHex(keys[0]));
+    ASSERT_EQ("042666b49184cf5c68de9628d0397b36", ToHex(keys[2]));
+    ASSERT_EQ("c46551cef9fd244faa9ad834130d3b38", ToHex(keys[3]));
+    ASSERT_EQ("042666b49184cf5c68de9628d0397b36", ToHex(keys[5]));
+
+    KeyChain other = bdk.MakeKeyChain(otherKsn);
+    const Key otherKey = other.DeriveKey(1, KeyUsage::Pin);
+
+    ASSERT_EQ(otherKey, keys[1]);
+    ASSERT_EQ(otherKey, keys[4]);
+    ASSERT_NE(otherKey, keys[2]);
+}
+
+TEST(DukptTests, InvalidBdkTest)
+{
+    const std::vector<uint8_t> shortBdk(15, 0);
+
+    ASSERT_THROW(Bdk(shortBdk.begin(), shortBdk.end()), Chaos::Service::ChaosException);
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "Hash/Md5.hpp"
+#include "Hash/Sha1.hpp"
+#include "Kdf/Pbkdf2.hpp"
+#include "Service/ChaosException.hpp"
+#include "TestHex.hpp"
+
+using namespace Chaos::Kdf::Pbkdf2;
+using Chaos::Hash::Md5::Md5Hasher;
+using Chaos::Hash::Sha1::Sha1Hasher;
+using namespace ChaosTests;
+
+template<typename HasherImpl>
+static std::string DeriveHex(const std::string & password, const std::string & salt,
+                             uint32_t iterations, size_t size)
+{
+    const Pbkdf2<HasherImpl> kdf(password.begin(), password.end());
+
+    std::vector<uint8_t> out(size);
+    kdf.Derive(out.data(), out.size(), reinterpret_cast<const uint8_t *>(salt.data()), salt.size(), iterations);
+
+    return ToHex(out);
+}
+
+TEST(Pbkdf2Tests, Rfc6070Test)
+{
+    ASSERT_EQ("0c60c80f961f0e71f3a9b524af6012062fe037a6", DeriveHex<Sha1Hasher>("password", "salt", 1, 20));
+    ASSERT_EQ("ea6c014dc72d6f8ccd1ed92ace1d41f0d8de8957", DeriveHex<Sha1Hasher>("password", "salt", 2, 20));
+    ASSERT_EQ("4b007901b765489abead49d926f721d065a429c1", DeriveHex<Sha1Hasher>("password", "salt", 4096, 20));
+
+    ASSERT_EQ("3d2eec4fe41c849b80c8d83662c0e44a8b291a964cf2f07038",
+              DeriveHex<Sha1Hasher>("passwordPASSWORDpassword", "saltSALTsaltSALTsaltSALTsaltSALTsalt", 4096, 25));
+
+    ASSERT_EQ("56fa6aa75548099dcc37d7f03425e0c3",
+              DeriveHex<Sha1Hasher>(std::string("pass\0word", 9), std::string("sa\0lt", 5), 4096, 16));
+}
+
+TEST(Pbkdf2Tests, Wpa2PskTest)
+{
+    ASSERT_EQ("f42c6fc52df0ebef9ebb4b90b38a5f902e83fe1b135a70e23aed762e9710a12e",
+              DeriveHex<Sha1Hasher>("password", "IEEE", 4096, 32));
+}
+
+TEST(Pbkdf2Tests, LongPasswordTest)
+{
+    ASSERT_EQ("bf94cb1b26465c7332844a102eaf01faba310edb", DeriveHex<Sha1Hasher>(std::string(100, 'x'), "salt", 3, 20));
+}
+
+TEST(Pbkdf2Tests, Md5Test)
+{
+    ASSERT_EQ("15001f89b9c29ee6998c520d1a0629e893cc3f996a08d27060e4c33305bf0fb262e27c0c9745202f",
+              DeriveHex<Md5Hasher>("password", "salt", 4096, 40));
+}
+
+TEST(Pbkdf2Tests, DeriveBatchTest)
+{
+    const std::string ssid = "IEEE";
+    const uint8_t * salt = reinterpret_cast<const uint8_t *>(ssid.data());
+
+    const std::string password = "password";
+    const Pbkdf2<Sha1Hasher> kdf(password.begin(), password.end());
+
+    std::vector<std::vector<uint8_t>> outs(5, std::vector<uint8_t>(32));
+    std::vector<Pbkdf2<Sha1Hasher>::DeriveRequest> requests;
+
+    for (size_t i = 0; i < outs.size(); ++i)
+    {
+        requests.push_back({ &kdf, salt, ssid.size(), i % 2 == 0 ? 4096u : 1000u, outs[i].data(), outs[i].size() });
+    }
+
+    Pbkdf2<Sha1Hasher>::DeriveBatch(requests.data(), requests.size());
+
+    for (size_t i = 0; i < outs.size(); ++i)
+    {
+        ASSERT_EQ(i % 2 == 0 ? "f42c6fc52df0ebef9ebb4b90b38a5f902e83fe1b135a70e23aed762e9710a12e"
+                             : "6f2a0247007a9f09a33fc68b5625ec76bed9ca1e37e067a582af0560f4f7b818",
+                  ToHex(outs[i]));
+    }
+}
+
+TEST(Pbkdf2Tests, ZeroIterationsTest)
+{
+    const std::string password = "password";
+    const Pbkdf2<Sha1Hasher> kdf(password.begin(), password.end());
+
+    std::vector<uint8_t> out(20);
+
+    ASSERT_THROW(kdf.Derive(out.data(), out.size(), out.data(), 0, 0), Chaos::Service::ChaosException);
+
+    std::vector<std::vector<uint8_t>> outs(6, std::vector<uint8_t>(20, 0xee));
+    std::vector<Pbkdf2<Sha1Hasher>::DeriveRequest> requests;
+
+    for (size_t i = 0; i < outs.size(); ++i)
+    {
+        requests.push_back({ &kdf, out.data(), 0, i + 1 < outs.size() ? 2u : 0u, outs[i].data(), outs[i].size() });
+    }
+
+    ASSERT_THROW(Pbkdf2<Sha1Hasher>::DeriveBatch(requests.data(), requests.size()), Chaos::Service::ChaosException);
+
+    for (const std::vector<uint8_t> & untouched : outs)
+    {
+        ASSERT_EQ(std::vector<uint8_t>(20, 0xee), untouched);
+    }
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Kdf/TlsPrf.hpp"
+#include "TestHex.hpp"
+
+using namespace Chaos::Kdf::TlsPrf;
+using namespace ChaosTests;
+
+static std::vector<uint8_t> Sequence(uint8_t first, size_t size)
+{
+    std::vector<uint8_t> result(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        result[i] = static_cast<uint8_t>(first + i);
+    }
+
+    return result;
+}
+
+TEST(TlsPrfTests, GenerateTest)
+{
+    const std::vector<uint8_t> secret(48, 0xab);
+    const std::vector<uint8_t> seed(64, 0xcd);
+    const std::string label = "PRF Testvector";
+
+    const TlsPrf prf(secret.begin(), secret.end());
+
+    std::vector<uint8_t> out(104);
+    prf.Generate(out.data(), out.size(), { { label.data(), label.size() }, { seed.data(), seed.size() } });
+
+    ASSERT_EQ("d3d4d1e349b5d515044666d51de32bab258cb521b6b053463e354832fd976754"
+              "443bcf9a296519bc289abcbc1187e4ebd31e602353776c408aafb74cbc85eff6"
+              "9255f9788faa184cbb957a9819d84a5d7eb006eb459d3ae8de9810454b8b2d8f"
+              "1afbc655a8c9a013", ToHex(out));
+}
+
+TEST(TlsPrfTests, OddSecretTest)
+{
+    const std::vector<uint8_t> secret = Sequence(0, 47);
+    const std::vector<uint8_t> seed = Sequence(100, 64);
+    const std::string label = "key expansion";
+
+    const TlsPrf prf(secret.begin(), secret.end());
+
+    std::vector<uint8_t> out(136);
+    prf.Generate(out.data(), out.size(), { { label.data(), label.size() }, { seed.data(), seed.size() } });
+
+    ASSERT_EQ("b2318ddf6d7672a132c0bcad231569dc85fbe89ae6f8648331e0b0ded34cd90d"
+              "10aafba6142d37159c8355776e4130a25ea41f8e942df53093bea61f6cd624c8"
+              "91fcbbea4aa6e2bb91e217299fac33645166c014e503dfd2616de70f234925a0"
+              "b69f86d2730aa764b537b5606607b44c2ce66f55bc9ad8969bfca017f38cd704"
+              "814359dc0075a108", ToHex(out));
+
+    const std::list<uint8_t> listSecret(secret.begin(), secret.end());
+    const TlsPrf listPrf(listSecret.begin(), listSecret.end());
+
+    std::vector<uint8_t> listOut(out.size());
+    listPrf.Generate(listOut.data(), listOut.size(), { { label.data(), label.size() }, { seed.data(), seed.size() } });
+
+    ASSERT_EQ(out, listOut);
+
+    std::istringstream stream(std::string(secret.begin(), secret.end()));
+    const TlsPrf streamPrf { std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+
+    std::vector<uint8_t> streamOut(out.size());
+    streamPrf.Generate(streamOut.data(), streamOut.size(), { { label.data(), label.size() }, { seed.data(), seed.size() } });
+
+    ASSERT_EQ(out, streamOut);
+}
+
+TEST(TlsPrfTests, EmptySecretTest)
+{
+    const std::vector<uint8_t> secret;
+    const TlsPrf prf(secret.begin(), secret.end());
+
+    std::vector<uint8_t> out(5);
+    prf.Generate(out.data(), out.size(), { { "x", 1 }, { "y", 1 } });
+
+    ASSERT_EQ("b31b1a0e86", ToHex(out));
+}
+
+TEST(TlsPrfTests, HandshakeTest)
+{
+    const std::vector<uint8_t> secret = Sequence(0, 48);
+    const std::vector<uint8_t> clientRandom = Sequence(0, 32);
+    const std::vector<uint8_t> serverRandom = Sequence(32, 32);
+
+    const TlsPrf preMaster(secret.begin(), secret.end());
+    const MasterSecret masterSecret = preMaster.ComputeMasterSecret(clientRandom.data(), serverRandom.data());
+
+    ASSERT_EQ("539391828d1d131678646180c5bda5c9a2eb62382c8cfb9440545cae85c8c205"
+              "b93e0d22161e06be1189235aefca7570", ToHex(masterSecret));
+
+    const TlsPrf master(secret.begin(), secret.end());
+
+    std::vector<uint8_t> keyBlock(104);
+    master.ComputeKeyBlock(keyBlock.data(), keyBlock.size(), serverRandom.data(), clientRandom.data());
+
+    ASSERT_EQ("f3771f99cf91858748dc50ed540edc39efb06a256dcd4d9ffdf87298f72cf700"
+              "f5585f14e9db80e3af1a7ccc2c218d42b36aa1a7584498f75edaca5bf8f86328"
+              "bfd1fa7577fd88c0ffb682e2db691a4273d72711a70f82d180e78fbda5f5d14e"
+              "01b717cf0173305e", ToHex(keyBlock));
+
+    const std::vector<uint8_t> handshakeHashes = Sequence(0, HANDSHAKE_HASHES_SIZE_BYTES);
+
+    ASSERT_EQ("692092a3e7dc81ef589a573a",
+              ToHex(master.ComputeVerifyData(CLIENT_FINISHED_LABEL, handshakeHashes.data())));
+    ASSERT_EQ("1f7bc82f04d0d5d64bd462e7",
+              ToHex(master.ComputeVerifyData(SERVER_FINISHED_LABEL, handshakeHashes.data())));
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Kdf/UnixCrypt.hpp"
+#include "Service/ChaosException.hpp"
+
+using namespace Chaos::Kdf::UnixCrypt;
+
+static std::string CryptString(const std::string & password, const std::string & salt)
+{
+    return Crypt(password.begin(), password.end(), salt);
+}
+
+TEST(UnixCryptTests, CryptTest)
+{
+    ASSERT_EQ("abgOeLfPimXQo", CryptString("test", "ab"));
+    ASSERT_EQ("..X8NBuQ4l6uQ", CryptString("", ".."));
+    ASSERT_EQ("zzXUHfURnGg8I", CryptString("password", "zz"));
+    ASSERT_EQ("./7H4fGCYxIHQ", CryptString("x", "./"));
+    ASSERT_EQ("9z03UZNtgFoJI", CryptString("Hello, World", "9z"));
+    ASSERT_EQ("Zql7ufwWwp0bU", CryptString("\x7f\x01~", "Zq"));
+}
+
+TEST(UnixCryptTests, LongPasswordTest)
+{
+    ASSERT_EQ("Ab/ayEe37nAJA", CryptString("longerthan8chars", "Ab"));
+    ASSERT_EQ("Ab/ayEe37nAJA", CryptString("longerth", "Ab"));
+
+    const std::string password = "longerthan8chars";
+    const std::list<char> listPassword(password.begin(), password.end());
+
+    ASSERT_EQ("Ab/ayEe37nAJA", Crypt(listPassword.begin(), listPassword.end(), "Ab"));
+}
+
+TEST(UnixCryptTests, PasswordHashTest)
+{
+    const PasswordHash hash("9z03UZNtgFoJI");
+
+    ASSERT_EQ("9z", hash.GetSalt());
+    ASSERT_EQ("9z03UZNtgFoJI", hash.ToString());
+
+    const std::string password = "Hello, World";
+    const std::string wrongPassword = "Hello, w";
+
+    ASSERT_TRUE(hash.Verify(password.begin(), password.end()));
+    ASSERT_FALSE(hash.Verify(wrongPassword.begin(), wrongPassword.end()));
+    ASSERT_FALSE(hash.Verify(password.begin(), password.begin()));
+
+    const std::string salt = "9z03UZNtgFoJI";
+    ASSERT_EQ("9z03UZNtgFoJI", PasswordHash::Compute(password.begin(), password.end(), salt).ToString());
+}
+
+TEST(UnixCryptTests, VerifyBatchTest)
+{
+    const std::vector<std::string> encoded =
+    {
+        "Ph37xVEHK68Xg",
+        "XImnPoE.kB8eo",
+        "7ebQLW0S2J252",
+        "mXozcCT0mqY3o",
+        "4F8Nav0J4hsZE",
+        "L.r./WeDFJGNQ"
+    };
+
+    std::vector<PasswordHash> hashes;
+    std::vector<std::string> passwords;
+
+    for (size_t i = 0; i < encoded.size(); ++i)
+    {
+        hashes.emplace_back(encoded[i]);
+        passwords.push_back("user" + std::to_string(i));
+    }
+
+    passwords[3] = "user33";
+
+    std::vector<PasswordHash::VerifyRequest> requests;
+
+    for (size_t i = 0; i < hashes.size(); ++i)
+    {
+        requests.push_back({ &hashes[i], passwords[i].data(), passwords[i].size() });
+    }
+
+    bool results[6];
+    PasswordHash::VerifyBatch(requests.data(), requests.size(), results);
+
+    for (size_t i = 0; i < hashes.size(); ++i)
+    {
+        ASSERT_EQ(i != 3, results[i]);
+        ASSERT_EQ(i != 3, hashes[i].Verify(passwords[i].begin(), passwords[i].end()));
+    }
+}
+
+TEST(UnixCryptTests, BitslicedVerifyBatchTest)
+{
+    static const std::string ALPHABET = "./0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+    std::vector<PasswordHash> hashes;
+    std::vector<std::string> passwords;
+
+    for (size_t i = 0; i < 150; ++i)
+    {
+        const std::string salt = { ALPHABET[i * 7 % 64], ALPHABET[i * 13 % 64] };
+        std::string password(i % 11, static_cast<char>('a' + i % 26));
+
+        for (size_t j = 0; j < password.size(); ++j)
+        {
+            password[j] = static_cast<char>(password[j] + j * 37 % 90);
+        }
+
+        hashes.emplace_back(CryptString(password, salt));
+        passwords.push_back(password);
+    }
+
+    hashes[0] = PasswordHash("abgOeLfPimXQo");
+    passwords[0] = "test";
+    hashes[1] = PasswordHash("zzXUHfURnGg8I");
+    passwords[1] = "password";
+
+    std::vector<PasswordHash::VerifyRequest> requests;
+
+    for (size_t i = 0; i < hashes.size(); ++i)
+    {
+        const std::string & password = i % 5 == 3 ? passwords[i + 1] : passwords[i];
+        requests.push_back({ &hashes[i], password.data(), password.size() });
+    }
+
+    const std::unique_ptr<bool[]> results(new bool[requests.size()]);
+    PasswordHash::VerifyBatch(requests.data(), requests.size(), results.get());
+
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+        ASSERT_EQ(i % 5 != 3, results[i]);
+    }
+}
+
+TEST(UnixCryptTests, InvalidInputTest)
+{
+    const std::string password = "test";
+
+    ASSERT_THROW(CryptString(password, "a"), Chaos::Service::ChaosException);
+    ASSERT_THROW(CryptString(password, "a!"), Chaos::Service::ChaosException);
+
+    ASSERT_THROW(PasswordHash("abgOeLfPimXQ"), Chaos::Service::ChaosException);
+    ASSERT_THROW(PasswordHash("abgOeLfPimXQ*"), Chaos::Service::ChaosException);
+    ASSERT_THROW(PasswordHash("abgOeLfPimXQp"), Chaos::Service::ChaosException);
+}
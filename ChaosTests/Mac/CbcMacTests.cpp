@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "Cipher/Block/Des/Des3Crypt.hpp"
+#include "Cipher/Block/Des/DesCrypt.hpp"
+#include "Mac/CbcMac.hpp"
+#include "Service/ChaosException.hpp"
+#include "TestHex.hpp"
+
+using namespace Chaos::Mac::CbcMac;
+using Chaos::Cipher::Block::Des::DesCrypt;
+using Chaos::Cipher::Block::Des::Des3Crypt;
+using namespace ChaosTests;
+
+static std::vector<uint8_t> Sequence(size_t size, uint8_t first = 0)
+{
+    std::vector<uint8_t> result(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        result[i] = static_cast<uint8_t>(first + i);
+    }
+
+    return result;
+}
+
+static const std::vector<uint8_t> DES_KEY = FromHex("0123456789abcdef");
+static const std::vector<uint8_t> DOUBLE_KEY = FromHex("0123456789abcdeffedcba9876543210");
+
+TEST(CbcMacTests, DesCbcMacTest)
+{
+    const std::string message = "7654321 Now is the time for ";
+
+    CbcMac<DesCrypt::DesEncryptor> mac(DesCrypt::Key(DES_KEY.begin(), DES_KEY.end()));
+
+    mac.Update(message.begin(), message.end());
+    ASSERT_EQ("f1d30f6849312ca4", ToHex(mac.Finish()));
+
+    ASSERT_EQ("d5d44ff720683d0d", ToHex(mac.Finish()));
+
+    for (size_t split = 0; split <= message.size(); ++split)
+    {
+        mac.Update(message.begin(), message.begin() + split);
+        mac.Update(message.begin() + split, message.end());
+
+        ASSERT_EQ("f1d30f6849312ca4", ToHex(mac.Finish()));
+    }
+
+    const std::list<char> listMessage(message.begin(), message.end());
+    mac.Update(listMessage.begin(), listMessage.end());
+    ASSERT_EQ("f1d30f6849312ca4", ToHex(mac.Finish()));
+}
+
+TEST(CbcMacTests, Method2PaddingTest)
+{
+    const std::string message = "7654321 Now is the time for ";
+
+    CbcMac<DesCrypt::DesEncryptor> mac(DesCrypt::Key(DES_KEY.begin(), DES_KEY.end()), Padding::Method2);
+
+    mac.Update(message.begin(), message.end());
+    ASSERT_EQ("d0163999b2406ded", ToHex(mac.Finish()));
+}
+
+TEST(CbcMacTests, Des3CbcMacTest)
+{
+    const std::vector<uint8_t> message = Sequence(100);
+
+    CbcMac<Des3Crypt::Des3Encryptor> mac(Des3Crypt::Key(DOUBLE_KEY.begin(), DOUBLE_KEY.end()));
+
+    mac.Update(message.begin(), message.end());
+    ASSERT_EQ("a3eeeafd2b051e20", ToHex(mac.Finish()));
+}
+
+TEST(CbcMacTests, RetailMacTest)
+{
+    const std::string message = "Now is the time for all ";
+
+    RetailMac mac(DOUBLE_KEY.begin(), DOUBLE_KEY.end());
+
+    mac.Update(message.begin(), message.end());
+    ASSERT_EQ("a1c72e74ea3fa9b6", ToHex(mac.Finish()));
+
+    const std::vector<uint8_t> data = Sequence(37);
+
+    mac.Update(data.begin(), data.end());
+    ASSERT_EQ("2fb2e78c09a5786e", ToHex(mac.Finish()));
+
+    RetailMac method2(DOUBLE_KEY.begin(), DOUBLE_KEY.end(), Padding::Method2);
+
+    method2.Update(data.begin(), data.end());
+    ASSERT_EQ("fa03177140a01d08", ToHex(method2.Finish()));
+}
+
+TEST(CbcMacTests, VerifyTest)
+{
+    const std::string message = "Now is the time for all ";
+    const std::vector<uint8_t> tag = FromHex("a1c72e74ea3fa9b6");
+
+    RetailMac mac(DOUBLE_KEY.begin(), DOUBLE_KEY.end());
+
+    mac.Update(message.begin(), message.end());
+    ASSERT_TRUE(mac.Verify(tag.data(), tag.size()));
+
+    mac.Update(message.begin(), message.end());
+    ASSERT_TRUE(mac.Verify(tag.data(), 4));
+
+    mac.Update(message.begin(), message.end() - 1);
+    ASSERT_FALSE(mac.Verify(tag.data(), 4));
+
+    mac.Update(message.begin(), message.end());
+    ASSERT_FALSE(mac.Verify(tag.data(), 0));
+}
+
+TEST(CbcMacTests, ComputeBatchTest)
+{
+    const std::vector<std::string> expected =
+    {
+        "ddada161e8d79673",
+        "4835722424726f81",
+        "c38fe8735cb6061f",
+        "6cdaf2d68e80df37",
+        "aff751312143be15"
+    };
+
+    std::vector<RetailMac> keys;
+    std::vector<std::vector<uint8_t>> messages;
+
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        std::vector<uint8_t> key(16);
+
+        for (size_t j = 0; j < key.size(); ++j)
+        {
+            key[j] = static_cast<uint8_t>(i * 17 + j);
+        }
+
+        keys.emplace_back(key.begin(), key.end());
+        messages.push_back(Sequence(i * 13));
+    }
+
+    std::vector<RetailMac::Request> requests;
+
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        requests.push_back({ &keys[i], messages[i].data(), messages[i].size() });
+    }
+
+    std::vector<Tag> tags(requests.size());
+    RetailMac::ComputeBatch(requests.data(), requests.size(), tags.data());
+
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(expected[i], ToHex(tags[i]));
+
+        keys[i].Update(messages[i].begin(), messages[i].end());
+        ASSERT_EQ(expected[i], ToHex(keys[i].Finish()));
+    }
+}
+
+TEST(CbcMacTests, BatchPaddingTest)
+{
+    const std::vector<uint8_t> key = FromHex("0123456789abcdeffedcba9876543210");
+
+    for (Padding padding : { Padding::Method1, Padding::Method2 })
+    {
+        std::vector<RetailMac> keys;
+        std::vector<std::vector<uint8_t>> messages;
+
+        for (size_t size : { 0, 1, 7, 8, 13, 16 })
+        {
+            keys.emplace_back(key.begin(), key.end(), padding);
+            messages.push_back(Sequence(size));
+        }
+
+        std::vector<RetailMac::Request> requests;
+
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            requests.push_back({ &keys[i], messages[i].data(), messages[i].size() });
+        }
+
+        std::vector<Tag> tags(requests.size());
+        RetailMac::ComputeBatch(requests.data(), requests.size(), tags.data());
+
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            keys[i].Update(messages[i].begin(), messages[i].end());
+            ASSERT_EQ(keys[i].Finish(), tags[i]);
+        }
+    }
+}
+
+TEST(CbcMacTests, InvalidKeyTest)
+{
+    ASSERT_THROW(RetailMac(DES_KEY.begin(), DES_KEY.end()), Chaos::Service::ChaosException);
+}
@@ -108,3 +108,60 @@ TEST(HmacTests, UninitializedHmacTest)
         ASSERT_THROW(hmac.Finish(), Chaos::Service::ChaosException);
     }
 }
+
+TEST(HmacTests, ReuseAfterFinishTest)
+{
+    const char * key = "Jefe";
+    const char * data = "what do ya want for nothing?";
+
+    Hmac<Md5Hasher> hmac(key, key + strlen(key));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        hmac.Update(data, data + strlen(data));
+        ASSERT_EQ("750c783e6ab0b503eaa86e310a5db738", hmac.Finish().ToHexString());
+    }
+
+    hmac.Update(key, key + strlen(key));
+    hmac.Reset();
+    hmac.Update(data, data + strlen(data));
+
+    ASSERT_EQ("750c783e6ab0b503eaa86e310a5db738", hmac.Finish().ToHexString());
+
+    Hmac<Md5Hasher> uninitialized;
+
+    ASSERT_THROW(uninitialized.Reset(), Chaos::Service::ChaosException);
+}
+
+TEST(HmacTests, SegmentUpdateTest)
+{
+    const char * key = "key";
+    const std::string header = "The quick brown ";
+    const std::string body = "fox jumps over the lazy dog";
+
+    {
+        Hmac<Md5Hasher> hmac(key, key + strlen(key));
+        hmac.Update({ { header.data(), header.size() }, { body.data(), body.size() } });
+
+        ASSERT_EQ("80070713463e7749b90c2dc24911e275", hmac.Finish().ToHexString());
+    }
+
+    {
+        const std::array<Chaos::Hash::Segment, 2> segments =
+        {{
+            { header.data(), header.size() },
+            { body.data(), body.size() }
+        }};
+
+        Hmac<Sha1Hasher> hmac(key, key + strlen(key));
+        hmac.Update(segments);
+
+        ASSERT_EQ("de7c9b85b8b78aa6bc8a7a36f70a90701c9db4d9", hmac.Finish().ToHexString());
+    }
+
+    {
+        Hmac<Md5Hasher> hmac;
+
+        ASSERT_THROW(hmac.Update({ { header.data(), header.size() } }), Chaos::Service::ChaosException);
+    }
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <limits>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "Protocol/Otp/Hotp.hpp"
+#include "Service/ChaosException.hpp"
+
+using namespace Chaos::Protocol::Otp;
+
+static const std::string SECRET = "12345678901234567890";
+
+TEST(HotpTests, GenerateTest)
+{
+    const std::vector<std::string> expected =
+    {
+        "755224", "287082", "359152", "969429", "338314",
+        "254676", "287922", "162583", "399871", "520489"
+    };
+
+    const Hotp<> hotp(SECRET.begin(), SECRET.end());
+
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(expected[i], hotp.Format(hotp.Generate(i)));
+    }
+
+    std::vector<uint32_t> codes(expected.size());
+    hotp.GenerateWindow(0, codes.size(), codes.data());
+
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(expected[i], hotp.Format(codes[i]));
+    }
+
+    const std::list<char> listSecret(SECRET.begin(), SECRET.end());
+    const Hotp<> listHotp(listSecret.begin(), listSecret.end());
+
+    ASSERT_EQ("520489", listHotp.Format(listHotp.Generate(9)));
+}
+
+TEST(HotpTests, LongSecretTest)
+{
+    const std::string secret(100, 'k');
+    const Hotp<> hotp(secret.begin(), secret.end(), 8);
+
+    const uint64_t counter = static_cast<uint64_t>(1) << 40;
+
+    ASSERT_EQ("98483307", hotp.Format(hotp.Generate(counter)));
+    ASSERT_EQ("84673027", hotp.Format(hotp.Generate(counter + 1)));
+}
+
+TEST(HotpTests, VerifyTest)
+{
+    const Hotp<> hotp(SECRET.begin(), SECRET.end());
+
+    ASSERT_EQ(0u, hotp.Verify("755224", 0, 0));
+    ASSERT_EQ(7u, hotp.Verify("162583", 3, 5));
+    ASSERT_EQ(9u, hotp.Verify("520489", 0, 9));
+
+    ASSERT_EQ(std::nullopt, hotp.Verify("162583", 3, 3));
+    ASSERT_EQ(std::nullopt, hotp.Verify("755224", 1, 20));
+
+    ASSERT_EQ(std::nullopt, hotp.Verify("75522", 0, 0));
+    ASSERT_EQ(std::nullopt, hotp.Verify("7552240", 0, 0));
+    ASSERT_EQ(std::nullopt, hotp.Verify("75522a", 0, 0));
+}
+
+TEST(HotpTests, VerifyWindowLimitsTest)
+{
+    const Hotp<> hotp(SECRET.begin(), SECRET.end());
+
+    const uint64_t last = std::numeric_limits<uint64_t>::max();
+    const std::string lastCode = hotp.Format(hotp.Generate(last));
+
+    ASSERT_EQ(last, hotp.Verify(lastCode, last - 2, 10));
+    ASSERT_EQ(last, hotp.Verify(lastCode, last, MAX_LOOK_AHEAD));
+    ASSERT_EQ(std::nullopt, hotp.Verify(hotp.Format(hotp.Generate(0)), last - 2, 10));
+
+    ASSERT_EQ(9u, hotp.Verify("520489", 0, MAX_LOOK_AHEAD));
+
+    ASSERT_THROW(hotp.Verify("755224", 0, MAX_LOOK_AHEAD + 1), Chaos::Service::ChaosException);
+    ASSERT_THROW(hotp.Verify("755224", 0, std::numeric_limits<size_t>::max()), Chaos::Service::ChaosException);
+
+    const Totp<> totp(SECRET.begin(), SECRET.end(), 8);
+
+    ASSERT_EQ(37037036u, totp.Verify("07081804", 1111111109, MAX_LOOK_AHEAD / 2));
+    ASSERT_THROW(totp.Verify("07081804", 1111111109, MAX_LOOK_AHEAD / 2 + 1), Chaos::Service::ChaosException);
+    ASSERT_THROW(totp.Verify("07081804", 1111111109, std::numeric_limits<size_t>::max()),
+                 Chaos::Service::ChaosException);
+}
+
+TEST(HotpTests, TotpTest)
+{
+    struct Vector
+    {
+        uint64_t Time_;
+        std::string Code_;
+    };
+
+    const std::vector<Vector> vectors =
+    {
+        { 59, "94287082" },
+        { 1111111109, "07081804" },
+        { 1111111111, "14050471" },
+        { 1234567890, "89005924" },
+        { 2000000000, "69279037" },
+        { 20000000000, "65353130" }
+    };
+
+    const Totp<> totp(SECRET.begin(), SECRET.end(), 8);
+
+    for (const Vector & vector : vectors)
+    {
+        ASSERT_EQ(vector.Code_, totp.Format(totp.Generate(vector.Time_)));
+        ASSERT_EQ(vector.Time_ / 30, totp.Verify(vector.Code_, vector.Time_, 0));
+    }
+
+    ASSERT_EQ(37037036u, totp.Verify("07081804", 1111111109 + 30, 1));
+    ASSERT_EQ(37037036u, totp.Verify("07081804", 1111111109 - 30, 1));
+    ASSERT_EQ(std::nullopt, totp.Verify("07081804", 1111111109 + 60, 1));
+
+    ASSERT_EQ(1u, totp.Verify("94287082", 0, 1));
+    ASSERT_EQ(std::nullopt, totp.Verify("94287082", 0, 0));
+}
+
+TEST(HotpTests, InvalidParametersTest)
+{
+    ASSERT_THROW(Hotp<>(SECRET.begin(), SECRET.end(), 5), Chaos::Service::ChaosException);
+    ASSERT_THROW(Hotp<>(SECRET.begin(), SECRET.end(), 9), Chaos::Service::ChaosException);
+    ASSERT_THROW(Hotp<>(SECRET.begin(), SECRET.end(), std::numeric_limits<size_t>::max()),
+                 Chaos::Service::ChaosException);
+    ASSERT_THROW(Totp<>(SECRET.begin(), SECRET.end(), 6, 0), Chaos::Service::ChaosException);
+
+    const Totp<> totp(SECRET.begin(), SECRET.end(), 6, 30, 100);
+    ASSERT_THROW(totp.Generate(99), Chaos::Service::ChaosException);
+}
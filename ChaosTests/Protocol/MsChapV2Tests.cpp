@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "Protocol/MsChap/MsChapV2.hpp"
+#include "Service/ChaosException.hpp"
+#include "TestHex.hpp"
+
+using namespace Chaos::Protocol::MsChap;
+using namespace ChaosTests;
+
+static const Challenge AUTHENTICATOR_CHALLENGE =
+{
+    0x5b, 0x5d, 0x7c, 0x7d, 0x7b, 0x3f, 0x2f, 0x3e,
+    0x3c, 0x2c, 0x60, 0x21, 0x32, 0x26, 0x26, 0x28
+};
+
+static const Challenge PEER_CHALLENGE =
+{
+    0x21, 0x40, 0x23, 0x24, 0x25, 0x5e, 0x26, 0x2a,
+    0x28, 0x29, 0x5f, 0x2b, 0x3a, 0x33, 0x7c, 0x7e
+};
+
+static const NtResponse NT_RESPONSE =
+{
+    0x82, 0x30, 0x9e, 0xcd, 0x8d, 0x70, 0x8b, 0x5e,
+    0xa0, 0x8f, 0xaa, 0x39, 0x81, 0xcd, 0x83, 0x54,
+    0x42, 0x33, 0x11, 0x4a, 0x3d, 0x85, 0xd6, 0xdf
+};
+
+static const std::string USER_NAME = "User";
+static const std::string PASSWORD = "clientPass";
+
+static VerifyRequest MakeRequest(const Credential & credential, const NtResponse & ntResponse)
+{
+    return { &credential, AUTHENTICATOR_CHALLENGE.data(), PEER_CHALLENGE.data(),
+             USER_NAME.data(), USER_NAME.size(), ntResponse.data() };
+}
+
+TEST(MsChapV2Tests, ExpandDesKeyTest)
+{
+    struct Helper
+    {
+        std::string operator()(const std::array<uint8_t, 7> & key56) const
+        {
+            Chaos::Cipher::Block::Des::DesCrypt::DesEncryptor enc(ExpandDesKey(key56.data()));
+
+            std::array<uint8_t, 8> out;
+            const std::array<uint8_t, 8> in = { 0xd0, 0x2e, 0x43, 0x86, 0xbc, 0xe9, 0x12, 0x26 };
+            enc.EncryptBlock(out.begin(), out.end(), in.begin(), in.end());
+
+            return ToHex(out.data(), out.size());
+        }
+    };
+
+    Helper encrypt;
+
+    ASSERT_EQ("82309ecd8d708b5e", encrypt({ 0x44, 0xeb, 0xba, 0x8d, 0x53, 0x12, 0xb8 }));
+    ASSERT_EQ("a08faa3981cd8354", encrypt({ 0xd6, 0x11, 0x47, 0x44, 0x11, 0xf5, 0x69 }));
+    ASSERT_EQ("4233114a3d85d6df", encrypt({ 0x89, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00 }));
+}
+
+TEST(MsChapV2Tests, RfcTest)
+{
+    const ChallengeHash challengeHash = ComputeChallengeHash(PEER_CHALLENGE.data(), AUTHENTICATOR_CHALLENGE.data(),
+                                                             USER_NAME.data(), USER_NAME.size());
+
+    ASSERT_EQ("d02e4386bce91226", ToHex(challengeHash.data(), challengeHash.size()));
+
+    const Credential credential = Credential::FromPassword(PASSWORD.begin(), PASSWORD.end());
+
+    const NtResponse ntResponse = credential.ComputeNtResponse(challengeHash);
+    ASSERT_EQ(NT_RESPONSE, ntResponse);
+
+    ASSERT_EQ("S=407A5589115FD0D6209F510FE9C04566932CDA56",
+              ToAuthenticatorString(credential.ComputeAuthenticatorResponse(ntResponse, challengeHash)));
+}
+
+TEST(MsChapV2Tests, VerifyTest)
+{
+    const std::array<uint8_t, 16> ntHash =
+    {
+        0x44, 0xeb, 0xba, 0x8d, 0x53, 0x12, 0xb8, 0xd6,
+        0x11, 0x47, 0x44, 0x11, 0xf5, 0x69, 0x89, 0xae
+    };
+
+    const Credential credential(ntHash.begin(), ntHash.end());
+
+    {
+        const VerifyResult result = Verify(MakeRequest(credential, NT_RESPONSE));
+
+        ASSERT_TRUE(result.IsValid_);
+        ASSERT_EQ("S=407A5589115FD0D6209F510FE9C04566932CDA56", ToAuthenticatorString(result.AuthenticatorResponse_));
+    }
+
+    {
+        NtResponse wrong = NT_RESPONSE;
+        wrong[23] ^= 0x01;
+
+        const VerifyResult result = Verify(MakeRequest(credential, wrong));
+
+        ASSERT_FALSE(result.IsValid_);
+        ASSERT_EQ(AuthenticatorResponse{}, result.AuthenticatorResponse_);
+    }
+}
+
+TEST(MsChapV2Tests, VerifyBatchTest)
+{
+    const Credential good = Credential::FromPassword(PASSWORD.begin(), PASSWORD.end());
+
+    const std::string otherPassword = "serverPass";
+    const Credential bad = Credential::FromPassword(otherPassword.begin(), otherPassword.end());
+
+    std::vector<VerifyRequest> requests;
+
+    for (size_t i = 0; i < 21; ++i)
+    {
+        requests.push_back(MakeRequest(i % 3 == 0 ? bad : good, NT_RESPONSE));
+    }
+
+    std::vector<VerifyResult> results(requests.size());
+    VerifyBatch(requests.data(), requests.size(), results.data());
+
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+        const VerifyResult single = Verify(requests[i]);
+
+        ASSERT_EQ(i % 3 != 0, results[i].IsValid_);
+        ASSERT_EQ(single.IsValid_, results[i].IsValid_);
+        ASSERT_EQ(single.AuthenticatorResponse_, results[i].AuthenticatorResponse_);
+    }
+}
+
+TEST(MsChapV2Tests, InvalidNtHashTest)
+{
+    const std::array<uint8_t, 15> shortHash = {};
+    ASSERT_THROW(Credential(shortHash.begin(), shortHash.end()), Chaos::Service::ChaosException);
+
+    const std::array<uint8_t, 17> longHash = {};
+    ASSERT_THROW(Credential(longHash.begin(), longHash.end()), Chaos::Service::ChaosException);
+}
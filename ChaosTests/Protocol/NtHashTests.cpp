@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include <list>
+#include <string>
+
+#include "Protocol/NtHash.hpp"
+#include "Service/ChaosException.hpp"
+
+using namespace Chaos::Protocol;
+
+TEST(NtHashTests, KnownValuesTest)
+{
+    ASSERT_EQ("31d6cfe0d16ae931b73c59d7e0c089c0", NtHash("").ToHexString());
+    ASSERT_EQ("8846f7eaee8fb117ad06bdd830b7586c", NtHash("password").ToHexString());
+}
+
+TEST(NtHashTests, NonAsciiPasswordTest)
+{
+    const std::string password = "\xd0\xbf\xd0\xb0\xd1\x80\xd0\xbe\xd0\xbb\xd1\x8c\xe2\x82\xac\xf0\x9f\x98\x80";
+
+    ASSERT_EQ("2b9c5196c5c69c6bf51d9cf004655161", NtHash(password.begin(), password.end()).ToHexString());
+
+    const std::list<char> list(password.begin(), password.end());
+
+    ASSERT_EQ("2b9c5196c5c69c6bf51d9cf004655161", NtHash(list.begin(), list.end()).ToHexString());
+}
+
+TEST(NtHashTests, LongPasswordTest)
+{
+    const std::string password(1000, 'a');
+
+    Chaos::Hash::Md4::Md4Hasher hasher;
+
+    for (char c : password)
+    {
+        const uint8_t unit[] = { static_cast<uint8_t>(c), 0 };
+        hasher.Update(unit, unit + 2);
+    }
+
+    ASSERT_EQ(hasher.Finish().ToHexString(), NtHash(password.begin(), password.end()).ToHexString());
+}
+
+TEST(NtHashTests, InvalidUtf8Test)
+{
+    for (const std::string & password : { std::string("\x80"),
+                                        std::string("a\xc3"),
+                                        std::string("\xc0\xaf"),
+                                        std::string("\xed\xa0\x80"),
+                                        std::string("\xf4\x90\x80\x80"),
+                                        std::string("\xe2\x28\xa1") })
+    {
+        ASSERT_THROW(NtHash(password.begin(), password.end()), Chaos::Service::ChaosException);
+    }
+}
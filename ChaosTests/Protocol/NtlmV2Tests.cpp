@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Protocol/Ntlm/NtlmV2.hpp"
+#include "Service/ChaosException.hpp"
+#include "TestHex.hpp"
+
+using namespace Chaos::Protocol::Ntlm;
+using namespace ChaosTests;
+
+static const std::array<uint8_t, 8> SERVER_CHALLENGE = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef };
+static const std::array<uint8_t, 8> CLIENT_CHALLENGE = { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa };
+
+static const std::vector<uint8_t> BLOB = FromHex("01010000000000000000000000000000aaaaaaaaaaaaaaaa00000000"
+                                                 "02000c0044006f006d00610069006e0001000c005300650072007600"
+                                                 "650072000000000000000000");
+
+static std::vector<uint8_t> MakeNtResponse(const ResponseKey & key)
+{
+    const NtProof proof = key.ComputeNtProof(SERVER_CHALLENGE.data(), BLOB.data(), BLOB.size());
+
+    std::vector<uint8_t> result(proof.size() + BLOB.size());
+    std::copy(proof.begin(), proof.end(), result.begin());
+    std::copy(BLOB.begin(), BLOB.end(), result.begin() + proof.size());
+
+    return result;
+}
+
+TEST(NtlmV2Tests, SpecTest)
+{
+    const std::string password = "Password";
+    const std::string user = "User";
+    const std::string domain = "Domain";
+
+    const Credential credential = Credential::FromPassword(password.begin(), password.end());
+    const ResponseKey key = credential.DeriveResponseKey(user.begin(), user.end(), domain.begin(), domain.end());
+
+    const NtProof proof = key.ComputeNtProof(SERVER_CHALLENGE.data(), BLOB.data(), BLOB.size());
+    ASSERT_EQ("68cd0ab851e51c96aabc927bebef6a1c", ToHex(proof.data(), proof.size()));
+
+    const SessionKey sessionKey = key.ComputeSessionBaseKey(proof);
+    ASSERT_EQ("8de40ccadbc14a82f15cb0ad0de95ca3", ToHex(sessionKey.data(), sessionKey.size()));
+
+    const LmV2Response lmResponse = key.ComputeLmV2Response(SERVER_CHALLENGE.data(), CLIENT_CHALLENGE.data());
+    ASSERT_EQ("86c35097ac9cec102554764a57cccc19aaaaaaaaaaaaaaaa", ToHex(lmResponse.data(), lmResponse.size()));
+
+    {
+        const std::string lowerUser = "user";
+        const ResponseKey lowerKey = credential.DeriveResponseKey(lowerUser.begin(), lowerUser.end(),
+                                                                  domain.begin(), domain.end());
+
+        ASSERT_EQ(proof, lowerKey.ComputeNtProof(SERVER_CHALLENGE.data(), BLOB.data(), BLOB.size()));
+    }
+
+    {
+        const std::vector<uint8_t> ntowfv2 = FromHex("0c868a403bfd7a93a3001ef22ef02e3f");
+        const ResponseKey directKey(ntowfv2.begin(), ntowfv2.end());
+
+        ASSERT_EQ(proof, directKey.ComputeNtProof(SERVER_CHALLENGE.data(), BLOB.data(), BLOB.size()));
+    }
+}
+
+TEST(NtlmV2Tests, NonAsciiUserTest)
+{
+    const std::vector<uint8_t> ntHash = FromHex("a4f49c406510bdcab6824ee7c30fd852");
+    const Credential credential(ntHash.begin(), ntHash.end());
+
+    const std::string user = "Jos\xc3\xa9.\xc3\x9cnl\xc3\xbc-\xce\xa9\xd0\xbc\xd0\xb5\xd0\xb3\xd0\xb0";
+    const std::string domain = "D\xc3\xb6main";
+
+    const std::vector<uint8_t> expected = FromHex("69dcecb8ffa86d5254dfd5900deb9470");
+    const ResponseKey expectedKey(expected.begin(), expected.end());
+
+    const std::list<char> userList(user.begin(), user.end());
+
+    for (const ResponseKey & key : { credential.DeriveResponseKey(user.begin(), user.end(), domain.begin(), domain.end()),
+                                     credential.DeriveResponseKey(userList.begin(), userList.end(), domain.begin(), domain.end()) })
+    {
+        ASSERT_EQ(expectedKey.ComputeNtProof(SERVER_CHALLENGE.data(), BLOB.data(), BLOB.size()),
+                  key.ComputeNtProof(SERVER_CHALLENGE.data(), BLOB.data(), BLOB.size()));
+    }
+}
+
+TEST(NtlmV2Tests, DotlessIUserTest)
+{
+    const std::vector<uint8_t> ntHash = FromHex("a4f49c406510bdcab6824ee7c30fd852");
+    const Credential credential(ntHash.begin(), ntHash.end());
+
+    const std::string domain = "Domain";
+
+    const std::vector<std::pair<std::string, std::string>> cases =
+    {
+        { "\xc4\xb1van", "739b71595481390b241f23613d92675b" },
+        { "IVAN", "739b71595481390b241f23613d92675b" },
+        { "\xc4\xb0van", "0b857f2cd147bbd35502b9021ceb3fba" }
+    };
+
+    for (const auto & [user, ntowfv2] : cases)
+    {
+        const std::vector<uint8_t> expected = FromHex(ntowfv2);
+        const ResponseKey expectedKey(expected.begin(), expected.end());
+
+        const ResponseKey key = credential.DeriveResponseKey(user.begin(), user.end(), domain.begin(), domain.end());
+
+        ASSERT_EQ(expectedKey.ComputeNtProof(SERVER_CHALLENGE.data(), BLOB.data(), BLOB.size()),
+                  key.ComputeNtProof(SERVER_CHALLENGE.data(), BLOB.data(), BLOB.size()));
+    }
+}
+
+TEST(NtlmV2Tests, LongUserNameTest)
+{
+    const std::vector<uint8_t> ntHash = FromHex("a4f49c406510bdcab6824ee7c30fd852");
+    const Credential credential(ntHash.begin(), ntHash.end());
+
+    std::string user;
+
+    for (size_t i = 0; i < 300; ++i)
+    {
+        user += (i % 37 == 5) ? "\xc3\xa9" : std::string(1, static_cast<char>('a' + i % 26));
+    }
+
+    const std::string domain = "";
+    const std::list<char> userList(user.begin(), user.end());
+
+    const ResponseKey contiguous = credential.DeriveResponseKey(user.data(), user.data() + user.size(),
+                                                                domain.begin(), domain.end());
+    const ResponseKey nonContiguous = credential.DeriveResponseKey(userList.begin(), userList.end(),
+                                                                   domain.begin(), domain.end());
+
+    ASSERT_EQ(contiguous.ComputeNtProof(SERVER_CHALLENGE.data(), BLOB.data(), BLOB.size()),
+              nonContiguous.ComputeNtProof(SERVER_CHALLENGE.data(), BLOB.data(), BLOB.size()));
+}
+
+TEST(NtlmV2Tests, VerifyTest)
+{
+    const std::vector<uint8_t> ntowfv2 = FromHex("0c868a403bfd7a93a3001ef22ef02e3f");
+    const ResponseKey key(ntowfv2.begin(), ntowfv2.end());
+
+    const std::vector<uint8_t> ntResponse = MakeNtResponse(key);
+
+    {
+        const VerifyResult result = Verify({ &key, SERVER_CHALLENGE.data(), ntResponse.data(), ntResponse.size() });
+
+        ASSERT_TRUE(result.IsValid_);
+        ASSERT_EQ("8de40ccadbc14a82f15cb0ad0de95ca3", ToHex(result.SessionBaseKey_.data(), result.SessionBaseKey_.size()));
+    }
+
+    for (size_t pos : { size_t(0), size_t(15), size_t(16), ntResponse.size() - 1 })
+    {
+        std::vector<uint8_t> tampered = ntResponse;
+        tampered[pos] ^= 0x01;
+
+        const VerifyResult result = Verify({ &key, SERVER_CHALLENGE.data(), tampered.data(), tampered.size() });
+
+        ASSERT_FALSE(result.IsValid_);
+        ASSERT_EQ(SessionKey{}, result.SessionBaseKey_);
+    }
+
+    {
+        ASSERT_FALSE(Verify({ &key, SERVER_CHALLENGE.data(), ntResponse.data(), 16 + MIN_BLOB_SIZE_BYTES - 1 }).IsValid_);
+    }
+}
+
+TEST(NtlmV2Tests, VerifyBatchTest)
+{
+    const std::vector<uint8_t> ntowfv2 = FromHex("0c868a403bfd7a93a3001ef22ef02e3f");
+    const ResponseKey key(ntowfv2.begin(), ntowfv2.end());
+
+    const std::vector<uint8_t> ntResponse = MakeNtResponse(key);
+    std::vector<uint8_t> wrong = ntResponse;
+    wrong[3] ^= 0x80;
+
+    std::vector<VerifyRequest> requests;
+
+    for (size_t i = 0; i < 10; ++i)
+    {
+        const std::vector<uint8_t> & response = i % 4 == 1 ? wrong : ntResponse;
+        requests.push_back({ &key, SERVER_CHALLENGE.data(), response.data(), response.size() });
+    }
+
+    std::vector<VerifyResult> results(requests.size());
+    VerifyBatch(requests.data(), requests.size(), results.data());
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        ASSERT_EQ(i % 4 != 1, results[i].IsValid_);
+    }
+}
+
+TEST(NtlmV2Tests, InvalidKeyTest)
+{
+    const std::array<uint8_t, 15> shortKey = {};
+
+    ASSERT_THROW(ResponseKey(shortKey.begin(), shortKey.end()), Chaos::Service::ChaosException);
+    ASSERT_THROW(Credential(shortKey.begin(), shortKey.end()), Chaos::Service::ChaosException);
+}
@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "Protocol/Radius/RadiusCrypto.hpp"
+#include "Service/ChaosException.hpp"
+#include "TestHex.hpp"
+
+using namespace Chaos::Protocol::Radius;
+using namespace ChaosTests;
+
+static const std::string SECRET = "xyzzy5461";
+
+static const std::vector<uint8_t> REQUEST_AUTHENTICATOR = FromHex("0f403f9473978057bd83d5cb98f4227a");
+
+TEST(RadiusCryptoTests, UserPasswordTest)
+{
+    const SharedSecret secret(SECRET.begin(), SECRET.end());
+
+    {
+        const std::string password = "arctangent";
+
+        std::vector<uint8_t> hidden(SharedSecret::GetHiddenPasswordSize(password.size()));
+        secret.HidePassword(hidden.data(), reinterpret_cast<const uint8_t *>(password.data()), password.size(),
+                            REQUEST_AUTHENTICATOR.data());
+
+        ASSERT_EQ("0dbe708d93d413ce3196e43f782a0aee", ToHex(hidden));
+
+        std::vector<uint8_t> revealed(hidden.size());
+        const size_t size = secret.RevealPassword(revealed.data(), hidden.data(), hidden.size(),
+                                                  REQUEST_AUTHENTICATOR.data());
+
+        ASSERT_EQ(password, std::string(revealed.begin(), revealed.begin() + size));
+    }
+
+    {
+        const std::string password(100, 'x');
+
+        std::vector<uint8_t> hidden(SharedSecret::GetHiddenPasswordSize(password.size()));
+        ASSERT_EQ(112, hidden.size());
+
+        secret.HidePassword(hidden.data(), reinterpret_cast<const uint8_t *>(password.data()), password.size(),
+                            REQUEST_AUTHENTICATOR.data());
+
+        ASSERT_EQ("14b46b818ac20cd3279a9c4700527296bb193f611118663016a74d176acf012fd6d77ab06b9e4411a73f640c736acb33"
+                  "a9d2673de6d043f4e46d185eb6609232f20cb7fc895d2590f320873bd5e6b1a6c80ca6ceec60d314114088b71d827cf3"
+                  "0d67ab07ada9be57c6f7a35c4eed75f8", ToHex(hidden));
+
+        std::vector<uint8_t> revealed(hidden.size());
+        const size_t size = secret.RevealPassword(revealed.data(), hidden.data(), hidden.size(),
+                                                  REQUEST_AUTHENTICATOR.data());
+
+        ASSERT_EQ(password, std::string(revealed.begin(), revealed.begin() + size));
+    }
+
+    {
+        std::vector<uint8_t> hidden(SharedSecret::GetHiddenPasswordSize(0));
+        ASSERT_EQ(16, hidden.size());
+
+        secret.HidePassword(hidden.data(), nullptr, 0, REQUEST_AUTHENTICATOR.data());
+
+        std::vector<uint8_t> revealed(hidden.size());
+        ASSERT_EQ(0, secret.RevealPassword(revealed.data(), hidden.data(), hidden.size(),
+                                           REQUEST_AUTHENTICATOR.data()));
+    }
+}
+
+TEST(RadiusCryptoTests, TunnelPasswordTest)
+{
+    const SharedSecret secret(SECRET.begin(), SECRET.end());
+
+    const std::string password = "tunnel-secret-password!!";
+    const std::array<uint8_t, 2> salt = { 0x85, 0x9a };
+
+    std::vector<uint8_t> hidden(SharedSecret::GetHiddenTunnelPasswordSize(password.size()));
+    secret.HideTunnelPassword(hidden.data(), reinterpret_cast<const uint8_t *>(password.data()), password.size(),
+                              REQUEST_AUTHENTICATOR.data(), salt.data());
+
+    ASSERT_EQ("859add3b594e733c8a89597ebe249c89c712b5d6386220413464ad5b84f687777da7", ToHex(hidden));
+
+    std::vector<uint8_t> revealed(hidden.size());
+    const size_t size = secret.RevealTunnelPassword(revealed.data(), hidden.data(), hidden.size(),
+                                                    REQUEST_AUTHENTICATOR.data());
+
+    ASSERT_EQ(password, std::string(revealed.begin(), revealed.begin() + size));
+
+    const std::array<uint8_t, 2> badSalt = { 0x05, 0x9a };
+    ASSERT_THROW(secret.HideTunnelPassword(hidden.data(), reinterpret_cast<const uint8_t *>(password.data()),
+                                           password.size(), REQUEST_AUTHENTICATOR.data(), badSalt.data()),
+                 Chaos::Service::ChaosException);
+}
+
+TEST(RadiusCryptoTests, ResponseTest)
+{
+    const SharedSecret secret(SECRET.begin(), SECRET.end());
+
+    {
+        const std::vector<uint8_t> accept = FromHex("0200002686fe220e7624ba2a1005f6bf9b55e0b20606000000010f06000000000e06c0a80103");
+
+        ASSERT_TRUE(secret.VerifyResponse(accept.data(), accept.size(), REQUEST_AUTHENTICATOR.data()));
+
+        std::vector<uint8_t> signed_ = accept;
+        std::fill(signed_.begin() + 4, signed_.begin() + 20, 0);
+        secret.SignResponse(signed_.data(), signed_.size(), REQUEST_AUTHENTICATOR.data());
+
+        ASSERT_EQ(accept, signed_);
+
+        std::vector<uint8_t> tampered = accept;
+        tampered.back() ^= 0x01;
+
+        ASSERT_FALSE(secret.VerifyResponse(tampered.data(), tampered.size(), REQUEST_AUTHENTICATOR.data()));
+    }
+
+    {
+        const std::vector<uint8_t> accept = FromHex("022a0038599a7db42e2686698a65990b5264a9b90606000000010f0600000000"
+                                                    "5012c7c16b47b945c6ae4e963159c011c9050e06c0a80103");
+
+        ASSERT_TRUE(secret.VerifyResponse(accept.data(), accept.size(), REQUEST_AUTHENTICATOR.data()));
+
+        std::vector<uint8_t> signed_ = accept;
+        std::fill(signed_.begin() + 4, signed_.begin() + 20, 0);
+        std::fill(signed_.begin() + 34, signed_.begin() + 50, 0);
+        secret.SignResponse(signed_.data(), signed_.size(), REQUEST_AUTHENTICATOR.data());
+
+        ASSERT_EQ(accept, signed_);
+
+        for (size_t pos : { size_t(5), size_t(40) })
+        {
+            std::vector<uint8_t> tampered = accept;
+            tampered[pos] ^= 0x01;
+
+            ASSERT_FALSE(secret.VerifyResponse(tampered.data(), tampered.size(), REQUEST_AUTHENTICATOR.data()));
+        }
+    }
+}
+
+TEST(RadiusCryptoTests, RequestTest)
+{
+    const SharedSecret secret(SECRET.begin(), SECRET.end());
+
+    {
+        const std::vector<uint8_t> request = FromHex("012a002c0f403f9473978057bd83d5cb98f4227a01066e656d6f"
+                                                     "5012d92dd92d6dbe4208a74c6fdd125a8c05");
+
+        ASSERT_TRUE(secret.VerifyRequest(request.data(), request.size()));
+
+        std::vector<uint8_t> signed_ = request;
+        std::fill(signed_.begin() + 28, signed_.end(), 0);
+        secret.SignRequest(signed_.data(), signed_.size());
+
+        ASSERT_EQ(request, signed_);
+
+        std::vector<uint8_t> tampered = request;
+        tampered[10] ^= 0x01;
+
+        ASSERT_FALSE(secret.VerifyRequest(tampered.data(), tampered.size()));
+    }
+
+    for (const std::string & hex : { std::string("0407002002689ecf85c942064beb0d89f7beb91f28060000000101066e656d6f"),
+                                   std::string("0408003250f21f6c2cedb4f0a4f7e1680c25c59128060000000101066e656d6f"
+                                               "50121900a9c4bde9c4f1bc2df9d0ef0e42b5") })
+    {
+        const std::vector<uint8_t> request = FromHex(hex);
+
+        ASSERT_TRUE(secret.VerifyRequest(request.data(), request.size()));
+
+        std::vector<uint8_t> signed_ = request;
+        std::fill(signed_.begin() + 4, signed_.begin() + 20, 0xee);
+        secret.SignRequest(signed_.data(), signed_.size());
+
+        ASSERT_EQ(request, signed_);
+
+        std::vector<uint8_t> tampered = request;
+        tampered[request.size() - 1] ^= 0x01;
+
+        ASSERT_FALSE(secret.VerifyRequest(tampered.data(), tampered.size()));
+    }
+}
+
+TEST(RadiusCryptoTests, MalformedPacketTest)
+{
+    const SharedSecret secret(SECRET.begin(), SECRET.end());
+
+    for (const std::string & hex : { std::string("0200002686fe220e7624ba2a1005f6bf9b55e0b2"),
+                                   std::string("0200001586fe220e7624ba2a1005f6bf9b55e0b206"),
+                                   std::string("0200001886fe220e7624ba2a1005f6bf9b55e0b20605"),
+                                   std::string("0200001886fe220e7624ba2a1005f6bf9b55e0b25004") })
+    {
+        std::vector<uint8_t> packet = FromHex(hex);
+
+        ASSERT_FALSE(secret.VerifyResponse(packet.data(), packet.size(), REQUEST_AUTHENTICATOR.data()));
+        ASSERT_THROW(secret.SignResponse(packet.data(), packet.size(), REQUEST_AUTHENTICATOR.data()),
+                     Chaos::Service::ChaosException);
+    }
+
+    {
+        const std::string empty;
+        ASSERT_THROW(SharedSecret(empty.begin(), empty.end()), Chaos::Service::ChaosException);
+    }
+
+    {
+        std::vector<uint8_t> out(32);
+        const std::vector<uint8_t> hidden(17);
+
+        ASSERT_THROW(secret.RevealPassword(out.data(), hidden.data(), hidden.size(), REQUEST_AUTHENTICATOR.data()),
+                     Chaos::Service::ChaosException);
+    }
+}
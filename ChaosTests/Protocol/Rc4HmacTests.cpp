@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "Protocol/Kerberos/Rc4Hmac.hpp"
+#include "Hash/Md5.hpp"
+#include "Service/ChaosException.hpp"
+#include "TestHex.hpp"
+
+using namespace Chaos::Protocol::Kerberos;
+using namespace ChaosTests;
+
+static const std::array<uint8_t, 16> KEY =
+{
+    0x88, 0x46, 0xf7, 0xea, 0xee, 0x8f, 0xb1, 0x17,
+    0xad, 0x06, 0xbd, 0xd8, 0x30, 0xb7, 0x58, 0x6c
+};
+
+static const std::array<uint8_t, Rc4Hmac::CONFOUNDER_SIZE_BYTES> CONFOUNDER =
+{
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08
+};
+
+static std::vector<uint8_t> Encrypt(Rc4Hmac & rc4Hmac, uint32_t usage, const std::vector<uint8_t> & plaintext)
+{
+    std::vector<uint8_t> result(plaintext.size() + Rc4Hmac::OVERHEAD_SIZE_BYTES);
+    rc4Hmac.Encrypt(result.data(), usage, CONFOUNDER.data(), plaintext.data(), plaintext.size());
+
+    return result;
+}
+
+TEST(Rc4HmacTests, EncryptTest)
+{
+    Rc4Hmac rc4Hmac(KEY.begin(), KEY.end());
+
+    {
+        ASSERT_EQ("7e774180c7763f3ff1b3b3f77dd3d3084a97cdaa7c7ff7b5", ToHex(Encrypt(rc4Hmac, 2, {})));
+    }
+
+    {
+        const std::string text = "The quick brown fox jumps over the lazy dog";
+
+        ASSERT_EQ("17540f20a627221af90dd5d2245cf72812a1003abe603f110be512a20bc3070893449b77425a2021b0190de635140fe506354ae866dbf40a6fc60c8272803154045218",
+                  ToHex(Encrypt(rc4Hmac, 3, std::vector<uint8_t>(text.begin(), text.end()))));
+    }
+
+    {
+        std::vector<uint8_t> plaintext(1000);
+
+        for (size_t i = 0; i < plaintext.size(); ++i)
+        {
+            plaintext[i] = static_cast<uint8_t>(i * 7 + 1);
+        }
+
+        const std::vector<uint8_t> ciphertext = Encrypt(rc4Hmac, 7, plaintext);
+
+        Chaos::Hash::Md5::Md5Hasher hasher;
+        hasher.Update(ciphertext.begin(), ciphertext.end());
+
+        ASSERT_EQ("9c4e7938567d5b0ff26fd368ed823529", hasher.Finish().ToHexString());
+    }
+}
+
+TEST(Rc4HmacTests, FromPasswordTest)
+{
+    const std::string password = "password";
+    Rc4Hmac rc4Hmac = Rc4Hmac::FromPassword(password.begin(), password.end());
+
+    ASSERT_EQ("7e774180c7763f3ff1b3b3f77dd3d3084a97cdaa7c7ff7b5", ToHex(Encrypt(rc4Hmac, 2, {})));
+}
+
+TEST(Rc4HmacTests, RoundTripTest)
+{
+    Rc4Hmac rc4Hmac(KEY.begin(), KEY.end());
+
+    for (uint32_t usage : { 1, 2, 3, 7, 8, 11, 12, 1 })
+    {
+        for (size_t size : { 0, 1, 511, 512, 513, 1500 })
+        {
+            std::vector<uint8_t> plaintext(size);
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                plaintext[i] = static_cast<uint8_t>(i * 13 + usage);
+            }
+
+            const std::vector<uint8_t> ciphertext = Encrypt(rc4Hmac, usage, plaintext);
+
+            std::vector<uint8_t> decrypted(size);
+            ASSERT_TRUE(rc4Hmac.Decrypt(decrypted.data(), usage, ciphertext.data(), ciphertext.size()));
+            ASSERT_EQ(plaintext, decrypted);
+        }
+    }
+}
+
+TEST(Rc4HmacTests, TamperedCiphertextTest)
+{
+    Rc4Hmac rc4Hmac(KEY.begin(), KEY.end());
+
+    const std::vector<uint8_t> plaintext(100, 0x42);
+    const std::vector<uint8_t> ciphertext = Encrypt(rc4Hmac, 2, plaintext);
+
+    for (size_t pos : { size_t(0), size_t(16), size_t(30), ciphertext.size() - 1 })
+    {
+        std::vector<uint8_t> tampered = ciphertext;
+        tampered[pos] ^= 0x01;
+
+        std::vector<uint8_t> decrypted(plaintext.size(), 0xff);
+        ASSERT_FALSE(rc4Hmac.Decrypt(decrypted.data(), 2, tampered.data(), tampered.size()));
+        ASSERT_EQ(std::vector<uint8_t>(plaintext.size(), 0), decrypted);
+    }
+
+    {
+        std::vector<uint8_t> decrypted(plaintext.size());
+        ASSERT_FALSE(rc4Hmac.Decrypt(decrypted.data(), 3, ciphertext.data(), ciphertext.size()));
+    }
+}
+
+TEST(Rc4HmacTests, InvalidInputTest)
+{
+    {
+        const std::array<uint8_t, 15> key = {};
+        ASSERT_THROW(Rc4Hmac(key.begin(), key.end()), Chaos::Service::ChaosException);
+    }
+
+    {
+        Rc4Hmac rc4Hmac(KEY.begin(), KEY.end());
+
+        std::array<uint8_t, 23> in = {};
+        std::array<uint8_t, 1> out = {};
+        ASSERT_THROW(rc4Hmac.Decrypt(out.data(), 2, in.data(), in.size()), Chaos::Service::ChaosException);
+    }
+}
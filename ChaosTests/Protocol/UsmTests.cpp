@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "Hash/Md5.hpp"
+#include "Hash/Sha1.hpp"
+#include "Protocol/Snmp/Usm.hpp"
+#include "Service/ChaosException.hpp"
+#include "TestHex.hpp"
+
+using namespace Chaos::Protocol::Snmp;
+using Chaos::Hash::Md5::Md5Hasher;
+using Chaos::Hash::Sha1::Sha1Hasher;
+using namespace ChaosTests;
+
+static const std::string PASSWORD = "maplesyrup";
+static const std::vector<uint8_t> ENGINE_ID = FromHex("000000000000000000000002");
+
+template<typename HasherImpl>
+static std::string MasterKeyHex(const std::string & password)
+{
+    const MasterKey<HasherImpl> key = MasterKey<HasherImpl>::FromPassword(password.begin(), password.end());
+    const uint8_t * raw = key.GetRawKey();
+
+    return ToHex(std::vector<uint8_t>(raw, raw + MasterKey<HasherImpl>::KEY_SIZE_BYTES));
+}
+
+TEST(UsmTests, PasswordToKeyMd5Test)
+{
+    ASSERT_EQ("9faf3283884e92834ebc9847d8edd963", MasterKeyHex<Md5Hasher>(PASSWORD));
+    ASSERT_EQ("1ed0f8613a09ea3aee2b6bcac2b32efb",
+              MasterKeyHex<Md5Hasher>("a-much-longer-password-that-does-not-divide-4096!"));
+    ASSERT_EQ("b561f87202d04959e37588ee05cf5b10", MasterKeyHex<Md5Hasher>(std::string(5000, 'x')));
+}
+
+TEST(UsmTests, PasswordToKeySha1Test)
+{
+    ASSERT_EQ("9fb5cc0381497b3793528939ff788d5d79145211", MasterKeyHex<Sha1Hasher>(PASSWORD));
+    ASSERT_EQ("0d88d258b8d0e2179c5b6fe874e581d554ba80f6",
+              MasterKeyHex<Sha1Hasher>("a-much-longer-password-that-does-not-divide-4096!"));
+    ASSERT_EQ("e37f4d5be56713044d62525e406d250a722647d6", MasterKeyHex<Sha1Hasher>(std::string(5000, 'x')));
+}
+
+TEST(UsmTests, LocalizeTest)
+{
+    const auto md5 = MasterKey<Md5Hasher>::FromPassword(PASSWORD.begin(), PASSWORD.end());
+    ASSERT_EQ("526f5eed9fcce26f8964c2930787d82b", ToHex(md5.Localize(ENGINE_ID.data(), ENGINE_ID.size())));
+
+    const auto sha1 = MasterKey<Sha1Hasher>::FromPassword(PASSWORD.begin(), PASSWORD.end());
+    ASSERT_EQ("6695febc9288e36282235fc7151f128497b38f3f",
+              ToHex(sha1.Localize(ENGINE_ID.data(), ENGINE_ID.size())));
+}
+
+TEST(UsmTests, LocalizeManyTest)
+{
+    const std::vector<uint8_t> ku = FromHex("9faf3283884e92834ebc9847d8edd963");
+    const MasterKey<Md5Hasher> key(ku.begin(), ku.end());
+
+    const std::vector<uint8_t> otherEngineId = FromHex("8000000001");
+
+    std::vector<EngineId> engineIds;
+
+    for (size_t i = 0; i < 7; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            engineIds.push_back({ ENGINE_ID.data(), ENGINE_ID.size() });
+        }
+        else
+        {
+            engineIds.push_back({ otherEngineId.data(), otherEngineId.size() });
+        }
+    }
+
+    for (size_t threadCount : { 1, 3, 16 })
+    {
+        std::vector<MasterKey<Md5Hasher>::LocalizedKey> results(engineIds.size());
+        key.LocalizeMany(engineIds.data(), engineIds.size(), results.data(), threadCount);
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            ASSERT_EQ(i % 2 == 0 ? "526f5eed9fcce26f8964c2930787d82b" : "cbee1a082c33f1791485319d98f3609f",
+                      ToHex(results[i]));
+        }
+    }
+}
+
+TEST(UsmTests, InvalidKeyTest)
+{
+    const std::string shortPassword = "syrup";
+
+    ASSERT_THROW(MasterKey<Md5Hasher>::FromPassword(shortPassword.begin(), shortPassword.end()),
+                 Chaos::Service::ChaosException);
+
+    const std::vector<uint8_t> shortKey(15, 0);
+
+    ASSERT_THROW(MasterKey<Md5Hasher>(shortKey.begin(), shortKey.end()), Chaos::Service::ChaosException);
+    ASSERT_THROW(Authenticator<Md5Hasher>(shortKey.begin(), shortKey.end()), Chaos::Service::ChaosException);
+    ASSERT_THROW(DesPrivacy(shortKey.begin(), shortKey.end()), Chaos::Service::ChaosException);
+}
+
+template<typename HasherImpl>
+static void CheckAuthenticator(const std::string & keyHex, const std::string & expectedHex)
+{
+    const std::vector<uint8_t> key = FromHex(keyHex);
+    const Authenticator<HasherImpl> authenticator(key.begin(), key.end());
+
+    std::vector<uint8_t> message(100);
+
+    for (size_t i = 0; i < message.size(); ++i)
+    {
+        message[i] = static_cast<uint8_t>(i);
+    }
+
+    authenticator.Sign(message.data(), message.size(), 40);
+
+    ASSERT_EQ(expectedHex, ToHex(std::vector<uint8_t>(message.begin() + 40, message.begin() + 52)));
+    ASSERT_TRUE(authenticator.Verify(message.data(), message.size(), 40));
+
+    message[99] ^= 0x01;
+    ASSERT_FALSE(authenticator.Verify(message.data(), message.size(), 40));
+    message[99] ^= 0x01;
+
+    message[51] ^= 0x01;
+    ASSERT_FALSE(authenticator.Verify(message.data(), message.size(), 40));
+
+    ASSERT_FALSE(authenticator.Verify(message.data(), message.size(), 90));
+    ASSERT_THROW(authenticator.Sign(message.data(), message.size(), 90), Chaos::Service::ChaosException);
+}
+
+TEST(UsmTests, HmacMd5Test)
+{
+    CheckAuthenticator<Md5Hasher>("526f5eed9fcce26f8964c2930787d82b", "e1cbd8a449283b79a3d0dde4");
+}
+
+TEST(UsmTests, HmacSha1Test)
+{
+    CheckAuthenticator<Sha1Hasher>("6695febc9288e36282235fc7151f128497b38f3f", "db466cbd7aa99cb2049fb8fe");
+}
+
+TEST(UsmTests, DesPrivacyTest)
+{
+    const std::vector<uint8_t> key = FromHex("526f5eed9fcce26f8964c2930787d82b");
+    const DesPrivacy privacy(key.begin(), key.end());
+
+    std::vector<uint8_t> plaintext(20);
+
+    for (size_t i = 0; i < plaintext.size(); ++i)
+    {
+        plaintext[i] = static_cast<uint8_t>(i);
+    }
+
+    std::vector<uint8_t> ciphertext(DesPrivacy::GetEncryptedSize(plaintext.size()));
+    std::array<uint8_t, PRIV_PARAMS_SIZE_BYTES> privParams;
+
+    privacy.Encrypt(ciphertext.data(), privParams.data(), plaintext.data(), plaintext.size(), 1, 0x12345678);
+
+    ASSERT_EQ("0000000112345678", ToHex(privParams));
+    ASSERT_EQ("48944c8ca52810a893e11721db6938c4702810635bc5f40c", ToHex(ciphertext));
+
+    std::vector<uint8_t> decrypted(ciphertext.size());
+    privacy.Decrypt(decrypted.data(), privParams.data(), ciphertext.data(), ciphertext.size());
+
+    plaintext.resize(decrypted.size(), 0);
+    ASSERT_EQ(plaintext, decrypted);
+
+    ASSERT_THROW(privacy.Decrypt(decrypted.data(), privParams.data(), ciphertext.data(), 7),
+                 Chaos::Service::ChaosException);
+}
+
+TEST(UsmTests, DesPrivacySha1KeyTest)
+{
+    const std::vector<uint8_t> sha1Key = FromHex("526f5eed9fcce26f8964c2930787d82bdeadbeef");
+    const std::vector<uint8_t> md5Key(sha1Key.begin(), sha1Key.begin() + 16);
+
+    const DesPrivacy truncated(sha1Key.begin(), sha1Key.end());
+    const DesPrivacy exact(md5Key.begin(), md5Key.end());
+
+    const std::array<uint8_t, 8> plaintext = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    std::array<uint8_t, 8> lhs, rhs;
+    std::array<uint8_t, PRIV_PARAMS_SIZE_BYTES> privParams;
+
+    truncated.Encrypt(lhs.data(), privParams.data(), plaintext.data(), plaintext.size(), 7, 9);
+    exact.Encrypt(rhs.data(), privParams.data(), plaintext.data(), plaintext.size(), 7, 9);
+
+    ASSERT_EQ(lhs, rhs);
+}
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <cstdint>
 #include <iterator>
+#include <utility>
+#include <vector>
 
 #include "Service/SeArray.hpp"
 
@@ -253,3 +255,148 @@ TEST(SeArrayTests, FillTest)
         ASSERT_EQ(-3, arr[i]);
     }
 }
+
+TEST(SeArrayTests, AlignmentTest)
+{
+    {
+        SeArray<uint8_t, 8> arr;
+
+        ASSERT_EQ(alignof(uint8_t), arr.Alignment());
+        ASSERT_EQ(sizeof(uint8_t) * 8, sizeof(arr));
+    }
+
+    {
+        SeArray<uint8_t, 100, 16> arr;
+
+        ASSERT_EQ(16, arr.Alignment());
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(arr.Begin()) % 16);
+        ASSERT_EQ(0, sizeof(arr) % 16);
+    }
+
+    {
+        CacheAlignedSeArray<uint64_t, 16> arr;
+
+        ASSERT_EQ(CACHE_LINE_SIZE, arr.Alignment());
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(arr.Begin()) % CACHE_LINE_SIZE);
+        ASSERT_EQ(2 * CACHE_LINE_SIZE, sizeof(arr));
+    }
+
+    {
+        CacheAlignedSeArray<uint8_t, 65> arr;
+
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(arr.Begin()) % CACHE_LINE_SIZE);
+        ASSERT_EQ(2 * CACHE_LINE_SIZE, sizeof(arr));
+    }
+}
+
+TEST(SeArrayTests, SizeClassTest)
+{
+    static_assert(SizeClassAlignment(1) == 1);
+    static_assert(SizeClassAlignment(8) == 8);
+    static_assert(SizeClassAlignment(9) == 16);
+    static_assert(SizeClassAlignment(64) == CACHE_LINE_SIZE);
+    static_assert(SizeClassAlignment(1000) == CACHE_LINE_SIZE);
+
+    {
+        SizeClassSeArray<uint8_t, 24> arr;
+
+        ASSERT_EQ(32, arr.Alignment());
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(arr.Begin()) % 32);
+        ASSERT_EQ(32, sizeof(arr));
+    }
+
+    {
+        SizeClassSeArray<uint32_t, 1> arr;
+
+        ASSERT_EQ(alignof(uint32_t), arr.Alignment());
+        ASSERT_EQ(sizeof(uint32_t), sizeof(arr));
+    }
+
+    {
+        SizeClassSeArray<uint64_t, 16> arr;
+
+        ASSERT_EQ(CACHE_LINE_SIZE, arr.Alignment());
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(arr.Begin()) % CACHE_LINE_SIZE);
+    }
+}
+
+TEST(SeArrayTests, AlignedEraseTest)
+{
+    CacheAlignedSeArray<uint32_t, 333> arr;
+
+    arr.Fill(0xdeadbeef);
+
+    for (size_t i = 0; i < arr.Size(); ++i)
+    {
+        ASSERT_EQ(0xdeadbeef, arr[i]);
+    }
+
+    arr.Erase();
+
+    for (size_t i = 0; i < arr.Size(); ++i)
+    {
+        ASSERT_EQ(0, arr[i]);
+    }
+}
+
+TEST(SeArrayTests, MoveConstructTest)
+{
+    SeArray<int32_t, 50> src;
+
+    for (size_t i = 0; i < src.Size(); ++i)
+    {
+        src[i] = static_cast<int32_t>(i + 1);
+    }
+
+    SeArray<int32_t, 50> dst(std::move(src));
+
+    for (size_t i = 0; i < dst.Size(); ++i)
+    {
+        ASSERT_EQ(static_cast<int32_t>(i + 1), dst[i]);
+        ASSERT_EQ(0, src[i]);
+    }
+}
+
+TEST(SeArrayTests, MoveAssignTest)
+{
+    CacheAlignedSeArray<uint64_t, 16> src;
+    CacheAlignedSeArray<uint64_t, 16> dst;
+
+    src.Fill(0x1122334455667788);
+    dst.Fill(3);
+
+    dst = std::move(src);
+
+    for (size_t i = 0; i < dst.Size(); ++i)
+    {
+        ASSERT_EQ(0x1122334455667788, dst[i]);
+        ASSERT_EQ(0, src[i]);
+    }
+
+    CacheAlignedSeArray<uint64_t, 16> & dstRef = dst;
+    dst = std::move(dstRef);
+
+    for (size_t i = 0; i < dst.Size(); ++i)
+    {
+        ASSERT_EQ(0x1122334455667788, dst[i]);
+    }
+}
+
+TEST(SeArrayTests, VectorOfSeArraysTest)
+{
+    std::vector<SeArray<uint8_t, 8>> vec;
+
+    for (uint8_t i = 0; i < 100; ++i)
+    {
+        vec.emplace_back();
+        vec.back().Fill(i);
+    }
+
+    for (uint8_t i = 0; i < 100; ++i)
+    {
+        for (size_t j = 0; j < vec[i].Size(); ++j)
+        {
+            ASSERT_EQ(i, vec[i][j]);
+        }
+    }
+}
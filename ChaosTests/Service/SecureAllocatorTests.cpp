@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Service/SecureAllocator.hpp"
+#include "Service/ChaosException.hpp"
+
+using namespace Chaos::Service;
+
+TEST(SecureAllocatorTests, VectorTest)
+{
+    std::vector<uint8_t, SecureAllocator<uint8_t>> vec;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        vec.push_back(static_cast<uint8_t>(i));
+    }
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(static_cast<uint8_t>(i), vec[i]);
+    }
+
+    vec.resize(20000, 0x5c);
+
+    ASSERT_EQ(0x5c, vec.back());
+    ASSERT_EQ(static_cast<uint8_t>(999), vec[999]);
+}
+
+TEST(SecureAllocatorTests, StringTest)
+{
+    using SecureString = std::basic_string<char, std::char_traits<char>, SecureAllocator<char>>;
+
+    SecureString str = "correct horse battery staple";
+    str += str;
+
+    ASSERT_EQ("correct horse battery staplecorrect horse battery staple",
+              std::string(str.begin(), str.end()));
+}
+
+TEST(SecureAllocatorTests, CustomPoolTest)
+{
+    SecurePool pool;
+
+    SecureAllocator<uint32_t> alloc(pool);
+    SecureAllocator<uint32_t> defaultAlloc;
+
+    ASSERT_EQ(&pool, &alloc.GetPool());
+    ASSERT_EQ(&SecurePool::Default(), &defaultAlloc.GetPool());
+    ASSERT_TRUE(alloc != defaultAlloc);
+
+    SecureAllocator<uint8_t> rebound(alloc);
+    ASSERT_TRUE(alloc == rebound);
+
+    std::vector<uint32_t, SecureAllocator<uint32_t>> vec(100, 7, alloc);
+    ASSERT_EQ(100, vec.size());
+    ASSERT_EQ(7, vec[50]);
+}
+
+TEST(SecureAllocatorTests, PoolReuseTest)
+{
+    SecurePool pool;
+
+    void * first = pool.Allocate(100);
+    pool.Deallocate(first, 100);
+
+    void * second = pool.Allocate(120);
+    ASSERT_EQ(first, second);
+
+    pool.Deallocate(second, 120);
+}
+
+TEST(SecureAllocatorTests, PoolSizeClassesTest)
+{
+    SecurePool pool;
+
+    std::vector<std::pair<void *, size_t>> blocks;
+
+    for (size_t size : { 1, 64, 65, 200, 1000, 4096, 4097, 100000 })
+    {
+        uint8_t * ptr = static_cast<uint8_t *>(pool.Allocate(size));
+
+        ASSERT_NE(nullptr, ptr);
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % CACHE_LINE_SIZE);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            ASSERT_EQ(0, ptr[i]);
+            ptr[i] = 0xff;
+        }
+
+        blocks.emplace_back(ptr, size);
+    }
+
+    for (auto [ptr, size] : blocks)
+    {
+        pool.Deallocate(ptr, size);
+    }
+}
+
+TEST(SecureAllocatorTests, PoolForeignPointerTest)
+{
+    SecurePool pool;
+
+    uint8_t foreign[64] = {};
+
+    ASSERT_DEATH(pool.Deallocate(foreign, sizeof(foreign)), "does not belong to the pool");
+    ASSERT_DEATH(pool.Deallocate(foreign, 10000), "does not belong to the pool");
+}
+
+TEST(SecureAllocatorTests, PoolManyArenasTest)
+{
+    SecurePool pool;
+
+    std::vector<void *> blocks;
+
+    for (size_t i = 0; i < 5 * SecurePool::ARENA_SIZE / SecurePool::MIN_BLOCK_SIZE; ++i)
+    {
+        blocks.push_back(pool.Allocate(SecurePool::MIN_BLOCK_SIZE));
+    }
+
+    for (size_t i = 0; i < blocks.size(); i += 2)
+    {
+        pool.Deallocate(blocks[i], SecurePool::MIN_BLOCK_SIZE);
+    }
+
+    for (size_t i = 1; i < blocks.size(); i += 2)
+    {
+        pool.Deallocate(blocks[i], SecurePool::MIN_BLOCK_SIZE);
+    }
+
+    void * small = pool.Allocate(100);
+    ASSERT_DEATH(pool.Deallocate(small, 300), "does not belong to the pool");
+    pool.Deallocate(small, 100);
+
+    uint8_t * large = static_cast<uint8_t *>(pool.Allocate(10000));
+    ASSERT_DEATH(pool.Deallocate(large + 64, 10000), "does not belong to the pool");
+    pool.Deallocate(large, 10000);
+}
+
+TEST(SecureAllocatorTests, PoolThreadsTest)
+{
+    SecurePool pool;
+
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&pool, t]()
+        {
+            std::vector<std::pair<uint8_t *, size_t>> blocks;
+
+            for (size_t i = 0; i < 1000; ++i)
+            {
+                const size_t size = 1 + (i * 37 + t) % 5000;
+                uint8_t * ptr = static_cast<uint8_t *>(pool.Allocate(size));
+
+                ptr[0] = static_cast<uint8_t>(t);
+                blocks.emplace_back(ptr, size);
+
+                if (i % 3 == 0)
+                {
+                    pool.Deallocate(blocks.front().first, blocks.front().second);
+                    blocks.erase(blocks.begin());
+                }
+            }
+
+            for (auto [ptr, size] : blocks)
+            {
+                pool.Deallocate(ptr, size);
+            }
+        });
+    }
+
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+}
+
+TEST(SecureAllocatorTests, NoexceptDeallocateTest)
+{
+    static_assert(noexcept(std::declval<SecureAllocator<uint8_t> &>().deallocate(nullptr, 1)));
+    static_assert(noexcept(std::declval<SecurePool &>().Deallocate(nullptr, 1)));
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <vector>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "Service/SecureArena.hpp"
+#include "Service/ChaosException.hpp"
+
+using namespace Chaos::Service;
+
+TEST(SecureArenaTests, AllocateDeallocateTest)
+{
+    SecureArena arena(32, 10);
+
+    ASSERT_EQ(CACHE_LINE_SIZE, arena.BlockSize());
+    ASSERT_EQ(10, arena.BlockCount());
+    ASSERT_EQ(10, arena.FreeBlockCount());
+
+    std::vector<void *> blocks;
+
+    for (size_t i = 0; i < arena.BlockCount(); ++i)
+    {
+        void * ptr = arena.Allocate();
+
+        ASSERT_NE(nullptr, ptr);
+        ASSERT_TRUE(arena.Owns(ptr));
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % CACHE_LINE_SIZE);
+
+        blocks.push_back(ptr);
+    }
+
+    ASSERT_EQ(0, arena.FreeBlockCount());
+    ASSERT_EQ(nullptr, arena.Allocate());
+
+    ASSERT_EQ(blocks.size(), std::set<void *>(blocks.begin(), blocks.end()).size());
+
+    for (void * ptr : blocks)
+    {
+        arena.Deallocate(ptr);
+    }
+
+    ASSERT_EQ(10, arena.FreeBlockCount());
+}
+
+TEST(SecureArenaTests, ZeroizeOnFreeTest)
+{
+    SecureArena arena(128, 1);
+
+    uint8_t * ptr = static_cast<uint8_t *>(arena.Allocate());
+    std::memset(ptr, 0xab, arena.BlockSize());
+
+    arena.Deallocate(ptr);
+
+    uint8_t * again = static_cast<uint8_t *>(arena.Allocate());
+    ASSERT_EQ(ptr, again);
+
+    for (size_t i = 0; i < arena.BlockSize(); ++i)
+    {
+        ASSERT_EQ(0, again[i]);
+    }
+
+    arena.Deallocate(again);
+}
+
+TEST(SecureArenaTests, ForeignPointerTest)
+{
+    SecureArena arena(64, 4);
+
+    uint8_t foreign[64] = {};
+
+    ASSERT_FALSE(arena.Owns(foreign));
+    ASSERT_DEATH(arena.Deallocate(foreign), "does not belong to the arena");
+
+    uint8_t * ptr = static_cast<uint8_t *>(arena.Allocate());
+
+    ASSERT_DEATH(arena.Deallocate(ptr + 1), "not a block start");
+
+    arena.Deallocate(ptr);
+}
+
+TEST(SecureArenaTests, DoubleFreeTest)
+{
+    SecureArena arena(64, 4);
+
+    void * first = arena.Allocate();
+    void * second = arena.Allocate();
+
+    arena.Deallocate(first);
+
+    ASSERT_DEATH(arena.Deallocate(first), "already free");
+    ASSERT_DEATH(arena.Deallocate(static_cast<uint8_t *>(first) + 2 * arena.BlockSize()), "already free");
+    ASSERT_EQ(3u, arena.FreeBlockCount());
+
+    arena.Deallocate(second);
+    ASSERT_EQ(4u, arena.FreeBlockCount());
+}
+
+TEST(SecureArenaTests, InvalidParametersTest)
+{
+    ASSERT_THROW(SecureArena(0, 10), ChaosException);
+    ASSERT_THROW(SecureArena(64, 0), ChaosException);
+}
+
+TEST(SecureArenaTests, GuardPageTest)
+{
+    SecureArena arena(4096, 1);
+
+    volatile uint8_t * ptr = static_cast<uint8_t *>(arena.Allocate());
+
+    ASSERT_DEATH({ ptr[-1] = 1; }, "");
+    ASSERT_DEATH({ ptr[arena.BlockSize()] = 1; }, "");
+
+    arena.Deallocate(const_cast<uint8_t *>(ptr));
+}
+
+// Without a memlock allowance a required lock is an error; a privileged
+// process may still lock, which is fine either way.
+static void LockWithoutAllowance()
+{
+    const rlimit noLocking = { 0, 0 };
+    setrlimit(RLIMIT_MEMLOCK, &noLocking);
+
+    SecureArena bestEffort(64, 4, LockPolicy::BestEffort);
+    bestEffort.Deallocate(bestEffort.Allocate());
+
+    try
+    {
+        SecureArena required(64, 4, LockPolicy::Require);
+        _exit(required.IsLocked() ? 0 : 1);
+    }
+    catch (const ChaosException &)
+    {
+        _exit(bestEffort.IsLocked() ? 1 : 0);
+    }
+}
+
+TEST(SecureArenaTests, LockPolicyTest)
+{
+    ASSERT_TRUE(SecureArena(64, 4).IsLocked());
+    ASSERT_EXIT(LockWithoutAllowance(), ::testing::ExitedWithCode(0), "");
+}
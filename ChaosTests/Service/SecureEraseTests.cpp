@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "Service/SecureErase.hpp"
+
+using namespace Chaos::Service;
+
+TEST(SecureEraseTests, EraseTest)
+{
+    {
+        std::array<uint8_t, 37> buf;
+        buf.fill(0xff);
+
+        SecureErase(buf.data(), buf.size());
+
+        for (uint8_t value : buf)
+        {
+            ASSERT_EQ(0, value);
+        }
+    }
+
+    {
+        std::vector<uint64_t> buf(1000, 0x0123456789abcdef);
+
+        SecureErase(buf.data(), buf.size() * sizeof(uint64_t));
+
+        for (uint64_t value : buf)
+        {
+            ASSERT_EQ(0, value);
+        }
+    }
+}
+
+TEST(SecureEraseTests, PartialEraseTest)
+{
+    std::array<uint8_t, 64> buf;
+    buf.fill(0xaa);
+
+    SecureErase(buf.data() + 3, 50);
+
+    for (size_t i = 0; i < buf.size(); ++i)
+    {
+        if (i >= 3 && i < 53)
+        {
+            ASSERT_EQ(0, buf[i]);
+        }
+        else
+        {
+            ASSERT_EQ(0xaa, buf[i]);
+        }
+    }
+}
+
+TEST(SecureEraseTests, EmptyEraseTest)
+{
+    std::array<uint8_t, 4> buf = { 1, 2, 3, 4 };
+
+    SecureErase(buf.data(), 0);
+    SecureErase(nullptr, 0);
+    SecureErase(nullptr, 10);
+
+    ASSERT_EQ((std::array<uint8_t, 4>{ 1, 2, 3, 4 }), buf);
+}
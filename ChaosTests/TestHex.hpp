@@ -0,0 +1,48 @@
+#ifndef CHAOS_TESTS_TESTHEX_HPP
+#define CHAOS_TESTS_TESTHEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace ChaosTests
+{
+
+inline std::vector<uint8_t> FromHex(const std::string & hex)
+{
+    std::vector<uint8_t> result;
+
+    for (size_t i = 0; i < hex.size(); i += 2)
+    {
+        result.push_back(static_cast<uint8_t>(std::stoi(hex.substr(i, 2), nullptr, 16)));
+    }
+
+    return result;
+}
+
+inline std::string ToHex(const uint8_t * data, size_t size)
+{
+    std::string result;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        char buf[3];
+        std::snprintf(buf, sizeof(buf), "%02x", data[i]);
+        result += buf;
+    }
+
+    return result;
+}
+
+template<typename Container>
+std::string ToHex(const Container & data)
+{
+    return ToHex(std::data(data), std::size(data));
+}
+
+} // namespace ChaosTests
+
+#endif // CHAOS_TESTS_TESTHEX_HPP